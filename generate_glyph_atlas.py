@@ -0,0 +1,370 @@
+#!/usr/bin/env python3
+"""
+Generate include/glyph_atlas.h: the timer digits and fixed screen labels
+pre-rendered from the classic 5x7 GFX font in SSD1306 page format.
+
+Each bitmap is already shifted to the row it is drawn at, so drawing it is
+a per-page byte copy. The idle-screen banner messages, read from
+src/monitor.cpp, are rendered into one 8-row strip of column bytes that the
+ticker scrolls a window over.
+
+Also generates include/text_font.h, the 5x8 font of the UTF-8 text engine
+(src/text.cpp): printable ASCII from the same font, Latin-1 and the euro
+sign. Accented letters are composed from their ASCII base letter; the other
+symbols are drawn below.
+
+Runs as a PlatformIO pre-build script (see platformio.ini) or by hand; the
+headers are only rewritten when they change.
+"""
+import json
+import os
+import re
+import unicodedata
+
+# Where the screens draw these (must match src/monitor.cpp)
+TIMER_Y = 22
+TIMER_SCALE = 3
+TIMER_CHARS = "0123456789:"
+LABELS = [
+    # name, text, y
+    ("WORK", "WORK", 2),
+    ("BREAK", "BREAK", 2),
+    ("COMPLETED", "Completed: ", 52),
+]
+
+FONT_FIRST = 0x20
+
+
+def project_dir():
+    try:
+        Import("env")  # noqa: F821 - provided by PlatformIO
+        return env["PROJECT_DIR"]  # noqa: F821
+    except NameError:
+        return os.path.dirname(os.path.abspath(__file__))
+
+
+def load_font(root):
+    """Column bytes of the classic font (LSB at the top), keyed by character."""
+    with open(os.path.join(root, "native", "glcdfont.h")) as f:
+        source = f.read()
+    body = source[source.index("glcdfont[] = {"):]
+    body = re.sub(r"//[^\n]*", "", body)
+    values = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", body)]
+    font = {}
+    for i in range(len(values) // 5):
+        font[chr(FONT_FIRST + i)] = values[i * 5:i * 5 + 5]
+    return font
+
+
+def load_banner_messages(root):
+    """The string literals of bannerMessages[] in src/monitor.cpp."""
+    with open(os.path.join(root, "src", "monitor.cpp")) as f:
+        source = f.read()
+    start = source.index("bannerMessages[] = {")
+    body = source[start:source.index("};", start)]
+    body = re.sub(r"//[^\n]*", "", body)
+    return [bytes(m, "utf-8").decode("unicode_escape")
+            for m in re.findall(r'"((?:[^"\\]|\\.)*)"', body)]
+
+
+def render(font, text, scale):
+    """Pixel rows (lists of 0/1) of `text` as GFX prints it: 6*scale
+    columns per character, 8*scale rows."""
+    width = len(text) * 6 * scale
+    rows = [[0] * width for _ in range(8 * scale)]
+    for n, ch in enumerate(text):
+        for col, bits in enumerate(font[ch]):
+            for row in range(8):
+                if bits & (1 << row):
+                    for dy in range(scale):
+                        for dx in range(scale):
+                            rows[row * scale + dy][(n * 6 + col) * scale + dx] = 1
+    return rows
+
+
+def to_pages(rows, y):
+    """Shift the rows down to screen row `y` and pack them into pages.
+    Returns (first page, page count, page-major bytes)."""
+    first = y // 8
+    last = (y + len(rows) - 1) // 8
+    width = len(rows[0])
+    data = []
+    for page in range(first, last + 1):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                r = page * 8 + bit - y
+                if 0 <= r < len(rows) and rows[r][x]:
+                    byte |= 1 << bit
+            data.append(byte)
+    return first, last - first + 1, data
+
+
+def page_masks(y, height):
+    """Bits of each page that the rows y..y+height-1 cover."""
+    masks = []
+    for page in range(y // 8, (y + height - 1) // 8 + 1):
+        mask = 0
+        for bit in range(8):
+            if y <= page * 8 + bit < y + height:
+                mask |= 1 << bit
+        masks.append(mask)
+    return masks
+
+
+def c_bytes(data, width, indent="  "):
+    """One line per page."""
+    lines = []
+    for i in range(0, len(data), width):
+        lines.append(indent + ", ".join(f"0x{b:02x}" for b in data[i:i + width]) + ",")
+    return "\n".join(lines)
+
+
+# Diacritics as (column, row) pixels. Lowercase letters start at row 2, so
+# their marks use rows 0-1; capitals move down a row to make room for a
+# one-row mark.
+MARKS_LOWER = {
+    "\u0300": [(1, 0), (2, 0)],                  # grave
+    "\u0301": [(3, 0), (4, 0)],                  # acute
+    "\u0302": [(1, 1), (2, 0), (3, 1)],          # circumflex
+    "\u0303": [(0, 1), (1, 0), (2, 1), (3, 0)],  # tilde
+    "\u0308": [(1, 0), (3, 0)],                  # diaeresis
+    "\u030A": [(2, 0)],                          # ring
+}
+MARKS_UPPER = {
+    "\u0300": [(1, 0)],
+    "\u0301": [(3, 0)],
+    "\u0302": [(1, 0), (2, 0), (3, 0)],
+    "\u0303": [(0, 0), (1, 0), (3, 0), (4, 0)],
+    "\u0308": [(1, 0), (3, 0)],
+    "\u030A": [(2, 0)],
+}
+CEDILLA = "\u0327"
+
+# Symbols that do not decompose, 5 columns by 8 rows
+SYMBOLS = {
+    "\u00A0": [".....", ".....", ".....", ".....", ".....", ".....", ".....", "....."],
+    "¡": ["..#..", ".....", "..#..", "..#..", "..#..", "..#..", "..#..", "....."],
+    "¢": ["..#..", ".####", "#.#..", "#.#..", "#.#..", ".####", "..#..", "....."],
+    "£": ["..##.", ".#..#", ".#...", "###..", ".#...", ".#..#", "#.##.", "....."],
+    "¥": ["#...#", ".#.#.", "#####", "..#..", "#####", "..#..", "..#..", "....."],
+    "¦": ["..#..", "..#..", "..#..", ".....", "..#..", "..#..", "..#..", "....."],
+    "§": [".###.", "#....", ".##..", "#..#.", ".##..", "...#.", "###..", "....."],
+    "¨": [".#.#.", ".....", ".....", ".....", ".....", ".....", ".....", "....."],
+    "ª": [".##..", "#.#..", ".##..", ".....", "###..", ".....", ".....", "....."],
+    "«": [".....", "..#.#", ".#.#.", "#.#..", ".#.#.", "..#.#", ".....", "....."],
+    "¬": [".....", ".....", ".....", "#####", "....#", ".....", ".....", "....."],
+    "\u00AD": [".....", ".....", ".....", "#####", ".....", ".....", ".....", "....."],
+    "¯": ["#####", ".....", ".....", ".....", ".....", ".....", ".....", "....."],
+    "°": [".##..", "#..#.", "#..#.", ".##..", ".....", ".....", ".....", "....."],
+    "±": ["..#..", "..#..", "#####", "..#..", "..#..", ".....", "#####", "....."],
+    "²": [".##..", "...#.", "..#..", ".###.", ".....", ".....", ".....", "....."],
+    "³": [".###.", "..#..", "...#.", ".##..", ".....", ".....", ".....", "....."],
+    "´": ["...#.", "..#..", ".....", ".....", ".....", ".....", ".....", "....."],
+    "µ": [".....", ".....", "#...#", "#...#", "#...#", "##.##", "#.##.", "#...."],
+    "·": [".....", ".....", ".....", "..#..", ".....", ".....", ".....", "....."],
+    "¸": [".....", ".....", ".....", ".....", ".....", ".....", "..#..", ".##.."],
+    "¹": ["..#..", ".##..", "..#..", ".###.", ".....", ".....", ".....", "....."],
+    "º": [".#...", "#.#..", ".#...", ".....", "###..", ".....", ".....", "....."],
+    "»": [".....", "#.#..", ".#.#.", "..#.#", ".#.#.", "#.#..", ".....", "....."],
+    "¿": ["..#..", ".....", "..#..", ".##..", "#....", "#...#", ".###.", "....."],
+    "Æ": [".####", "#.#..", "#.#..", "#####", "#.#..", "#.#..", "#.###", "....."],
+    "Ð": [".###.", ".#..#", ".#..#", "###.#", ".#..#", ".#..#", ".###.", "....."],
+    "×": [".....", "#...#", ".#.#.", "..#..", ".#.#.", "#...#", ".....", "....."],
+    "Ø": [".###.", "#..##", "#.#.#", "#.#.#", "#.#.#", "##..#", ".###.", "....."],
+    "Þ": ["#....", "####.", "#...#", "#...#", "####.", "#....", "#....", "....."],
+    "ß": [".##..", "#..#.", "#..#.", "#.#..", "#..#.", "#..#.", "#.##.", "#...."],
+    "æ": [".....", ".....", "##.#.", "..#.#", ".####", "#.#..", ".#.##", "....."],
+    "ð": [".#.#.", "..#..", ".#.#.", "...#.", ".####", "#...#", ".###.", "....."],
+    "÷": [".....", "..#..", ".....", "#####", ".....", "..#..", ".....", "....."],
+    "ø": [".....", ".....", ".###.", "#..##", "#.#.#", "##..#", ".###.", "....."],
+    "þ": [".....", "#....", "###..", "#..#.", "#..#.", "###..", "#....", "#...."],
+    "€": ["..###", ".#...", "####.", ".#...", "####.", ".#...", "..###", "....."],
+}
+
+TEXT_MISSING = [0x7F, 0x41, 0x41, 0x41, 0x7F]
+
+
+def symbol_columns(rows):
+    cols = [0] * 5
+    for r, line in enumerate(rows):
+        for c, pixel in enumerate(line):
+            if pixel == "#":
+                cols[c] |= 1 << r
+    return cols
+
+
+def compose(font, ch):
+    """Accented letter from its base letter, or None."""
+    parts = unicodedata.normalize("NFD", ch)
+    if len(parts) != 2 or parts[0] not in font:
+        return None
+    base, mark = parts
+    cols = list(font[base])
+    if mark == CEDILLA:
+        cols[2] |= 0x80
+        return cols
+    if base.isupper():
+        marks = MARKS_UPPER.get(mark)
+        cols = [(c << 1) & 0xFF for c in cols]
+    else:
+        marks = MARKS_LOWER.get(mark)
+        if base == "i":
+            cols[2] &= ~0x01  # dotless
+    if marks is None:
+        return None
+    for c, r in marks:
+        cols[c] |= 1 << r
+    return cols
+
+
+def text_font_glyph(font, ch):
+    if ch in SYMBOLS:
+        return symbol_columns(SYMBOLS[ch]), "drawn"
+    cols = compose(font, ch)
+    if cols is not None:
+        return cols, "composed"
+    return TEXT_MISSING, "missing"
+
+
+def generate_text_font(root):
+    font = load_font(root)
+    chars = [chr(c) for c in range(0x20, 0x7F)]
+    chars += [chr(c) for c in range(0xA0, 0x100)]
+    chars += ["€"]
+    out = []
+    out.append("// Generated by generate_glyph_atlas.py from native/glcdfont.h - do not edit.")
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("// 5x8 glyphs of the UTF-8 text engine, one byte per column (LSB at the top):")
+    out.append("// printable ASCII, Latin-1 (U+00A0-U+00FF) and the euro sign, then the")
+    out.append("// box drawn for anything else")
+    out.append("#define TEXT_FONT_COLUMNS 5")
+    out.append("#define TEXT_FONT_LATIN1_INDEX 95")
+    out.append(f"#define TEXT_FONT_EURO_INDEX {len(chars) - 1}")
+    out.append(f"#define TEXT_FONT_MISSING_INDEX {len(chars)}")
+    out.append(f"#define TEXT_FONT_GLYPHS {len(chars) + 1}")
+    out.append("")
+    out.append("static const uint8_t TEXT_FONT[TEXT_FONT_GLYPHS * TEXT_FONT_COLUMNS] PROGMEM = {")
+    for ch in chars:
+        if ch in font:
+            cols, how = font[ch], "ascii"
+        else:
+            cols, how = text_font_glyph(font, ch)
+        name = unicodedata.name(ch, "")
+        out.append("  " + ", ".join(f"0x{b:02x}" for b in cols)
+                   + f",  // U+{ord(ch):04X} {name.lower()} ({how})")
+    out.append("  " + ", ".join(f"0x{b:02x}" for b in TEXT_MISSING) + ",  // missing glyph")
+    out.append("};")
+    out.append("")
+    return "\n".join(out)
+
+
+def generate(root):
+    font = load_font(root)
+    out = []
+    out.append("// Generated by generate_glyph_atlas.py from native/glcdfont.h - do not edit.")
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("// A bitmap in SSD1306 page format: `pages` rows of `width` column bytes,")
+    out.append("// already shifted to the screen rows it is drawn at")
+    out.append("struct AtlasBitmap {")
+    out.append("  uint8_t width;")
+    out.append("  uint8_t firstPage;")
+    out.append("  uint8_t pages;")
+    out.append("  const uint8_t* data;")
+    out.append("};")
+    out.append("")
+
+    # Timer glyphs: one cell per character, drawn over whatever was there
+    cell = 6 * TIMER_SCALE
+    height = 8 * TIMER_SCALE
+    out.append(f"#define ATLAS_TIMER_Y {TIMER_Y}")
+    out.append(f"#define ATLAS_TIMER_CELL_WIDTH {cell}")
+    out.append(f'#define ATLAS_TIMER_CHARS "{TIMER_CHARS}"')
+    out.append("")
+    masks = page_masks(TIMER_Y, height)
+    out.append("// Bits of each page a timer cell owns (rows ATLAS_TIMER_Y onwards)")
+    out.append(f"static const uint8_t ATLAS_TIMER_PAGE_MASKS[{len(masks)}] = {{"
+               + ", ".join(f"0x{m:02x}" for m in masks) + "};")
+    out.append("")
+    glyphs = []
+    for ch in TIMER_CHARS:
+        first, pages, data = to_pages(render(font, ch, TIMER_SCALE), TIMER_Y)
+        name = "COLON" if ch == ":" else ch
+        out.append(f"static const uint8_t ATLAS_TIMER_{name}_DATA[] PROGMEM = {{  // '{ch}'")
+        out.append(c_bytes(data, cell))
+        out.append("};")
+        glyphs.append(f"  {{{cell}, {first}, {pages}, ATLAS_TIMER_{name}_DATA}},")
+    out.append("")
+    out.append("// Indexed by position in ATLAS_TIMER_CHARS")
+    out.append("static const AtlasBitmap ATLAS_TIMER_GLYPHS[] = {")
+    out.extend(glyphs)
+    out.append("};")
+    out.append("")
+
+    # Labels at text size 1
+    for name, text, y in LABELS:
+        first, pages, data = to_pages(render(font, text, 1), y)
+        out.append(f"#define ATLAS_LABEL_{name}_Y {y}")
+        out.append(f"static const uint8_t ATLAS_LABEL_{name}_DATA[] PROGMEM = {{  // \"{text}\"")
+        out.append(c_bytes(data, len(text) * 6))
+        out.append("};")
+        out.append(f"static const AtlasBitmap ATLAS_LABEL_{name} = "
+                   f"{{{len(text) * 6}, {first}, {pages}, ATLAS_LABEL_{name}_DATA}};")
+        out.append("")
+
+    # Banner messages at text size 1, back to back in one strip
+    messages = load_banner_messages(root)
+    strip = []
+    spans = []
+    for text in messages:
+        spans.append((len(strip), len(text) * 6, text))
+        for ch in text:
+            strip.extend(font[ch] + [0])
+    out.append("// Column range of one message in ATLAS_BANNER_STRIP")
+    out.append("struct AtlasSpan {")
+    out.append("  uint16_t offset;")
+    out.append("  uint16_t width;")
+    out.append("};")
+    out.append("")
+    out.append(f"#define ATLAS_BANNER_COUNT {len(messages)}")
+    out.append("// bannerMessages[] from src/monitor.cpp, one byte per column (LSB at the")
+    out.append("// top row of the text)")
+    out.append(f"static const uint8_t ATLAS_BANNER_STRIP[{len(strip)}] PROGMEM = {{")
+    for offset, width, text in spans:
+        out.append(f"  // {json.dumps(text)}")
+        out.append(c_bytes(strip[offset:offset + width], 24, "  "))
+    out.append("};")
+    out.append("static const AtlasSpan ATLAS_BANNER_SPANS[ATLAS_BANNER_COUNT] = {")
+    for offset, width, _ in spans:
+        out.append(f"  {{{offset}, {width}}},")
+    out.append("};")
+    out.append("")
+
+    return "\n".join(out)
+
+
+def write_if_changed(path, text):
+    try:
+        with open(path) as f:
+            if f.read() == text:
+                return
+    except FileNotFoundError:
+        pass
+    with open(path, "w") as f:
+        f.write(text)
+    print(f"Generated {path}")
+
+
+def main():
+    root = project_dir()
+    write_if_changed(os.path.join(root, "include", "glyph_atlas.h"), generate(root))
+    write_if_changed(os.path.join(root, "include", "text_font.h"), generate_text_font(root))
+
+
+main()
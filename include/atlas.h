@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+#include "glyph_atlas.h"
+
+// Drawing of pre-rendered bitmaps from glyph_atlas.h straight into an
+// SSD1306 framebuffer (128 columns, one byte per column per 8-row page).
+// The bitmaps are already shifted to their rows, so a draw is a loop of
+// byte copies per page instead of GFX's pixel-by-pixel scaled font.
+// Regenerate the atlas with generate_glyph_atlas.py when the text or the
+// rows it is drawn at change.
+
+#define ATLAS_FRAMEBUFFER_WIDTH 128
+
+/**
+ * Timer cell bitmap for `c`, or nullptr if the atlas has no glyph for it.
+ */
+const AtlasBitmap* atlas_timer_glyph(char c);
+
+/**
+ * Replaces the pixels under `pageMasks` (one mask per page of the bitmap)
+ * with the bitmap, so the area is cleared and drawn in one pass. Columns
+ * outside the framebuffer are skipped.
+ */
+void atlas_copy(uint8_t* framebuffer, int16_t x, const AtlasBitmap& bitmap, const uint8_t* pageMasks);
+
+/**
+ * Draws the set pixels of the bitmap in white, or in black when
+ * `inverted`, leaving the others alone (like GFX text without background).
+ */
+void atlas_draw(uint8_t* framebuffer, int16_t x, const AtlasBitmap& bitmap, bool inverted);
+
+/**
+ * Writes a timer string (digits and ':') as consecutive timer cells from
+ * column x. Returns false, drawing nothing, if a character is missing
+ * from the atlas.
+ */
+bool atlas_draw_timer(uint8_t* framebuffer, int16_t x, const char* text);
+
+/**
+ * Writes a full-width 8-row strip (ATLAS_FRAMEBUFFER_WIDTH column bytes,
+ * LSB at the top) with its top row at y, replacing those rows. When y is
+ * not on a page boundary each byte is shifted across two pages.
+ */
+void atlas_copy_rows(uint8_t* framebuffer, int16_t y, const uint8_t* columns);
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Boot pipeline timing.
+//
+// setup() only runs the quick, dependent init steps (serial, pins, display
+// bus, sensors) and then returns. The slow stages start from setup() but
+// finish from loop(), side by side: the LED self-test followed by the
+// startup jingle, the eyes intro, and the WiFi connection followed by the
+// menu fetch. Every phase records when it started and ended, relative to
+// reset, and is logged as it ends.
+//
+// The headline number is boot-to-interactive: the time from reset until
+// the first screen that takes input (normally the idle screen once the
+// intro is over) has been sent to the display.
+
+enum BootPhase : uint8_t {
+  // Synchronous, in setup()
+  BOOT_SERIAL,
+  BOOT_INPUTS,
+  BOOT_OUTPUTS,
+  BOOT_DISPLAY,
+  BOOT_SENSORS,
+  BOOT_POMODORO,
+  // Finished from loop()
+  BOOT_LED_TEST,
+  BOOT_JINGLE,
+  BOOT_INTRO,
+  BOOT_WIFI,     // until connected or given up
+  BOOT_MENU,     // first menu fetch
+  BOOT_PHASE_COUNT
+};
+
+struct BootPhaseTiming {
+  uint32_t startUs;  // micros() since reset
+  uint32_t endUs;
+  bool started;
+  bool done;
+};
+
+/**
+ * Records the start of a phase. A phase is timed once per boot; later
+ * calls are ignored.
+ */
+void boot_phase_begin(BootPhase phase);
+
+/**
+ * Records the end of a started phase and logs its timing.
+ */
+void boot_phase_end(BootPhase phase);
+
+/**
+ * Records the moment the first interactive frame is on the display and
+ * logs the boot-to-interactive time. Only the first call counts.
+ */
+void boot_mark_interactive();
+
+bool boot_is_interactive();
+
+/**
+ * Milliseconds from reset to the first interactive frame (0 until then).
+ */
+uint32_t boot_ms_to_interactive();
+
+const BootPhaseTiming& boot_get_phase(BootPhase phase);
+const char* boot_phase_name(BootPhase phase);
+
+// Times one synchronous step: BOOT_STEP(BOOT_DISPLAY, initializeDisplay());
+#define BOOT_STEP(phase, call)  \
+  do {                          \
+    boot_phase_begin(phase);    \
+    call;                       \
+    boot_phase_end(phase);      \
+  } while (0)
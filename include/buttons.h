@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+// Interrupt-driven button input.
+//
+// Both buttons raise a GPIO interrupt on every edge. The ISR only stores
+// the pin level and a micros() timestamp in a lock-free queue, so an edge
+// is captured even while loop() is stuck in a delay or a blocking screen
+// update. buttons_next_event() later runs the edges through a debouncer
+// that turns them into press, release, long-press, double-click and chord
+// events, each stamped with the time of the edge that caused it.
+//
+// Debouncing is leading-edge: the first edge is taken at once and the
+// following BUTTON_DEBOUNCE_MS of bouncing are ignored, then the pin level
+// is re-checked. A press costs no extra latency that way.
+
+#ifndef BUTTON_DEBOUNCE_MS
+#define BUTTON_DEBOUNCE_MS 30
+#endif
+
+#ifndef BUTTON_LONG_PRESS_MS
+#define BUTTON_LONG_PRESS_MS 1000
+#endif
+
+// A second press of the same button within this window is a double click
+#ifndef BUTTON_DOUBLE_CLICK_MS
+#define BUTTON_DOUBLE_CLICK_MS 350
+#endif
+
+// Raw edges buffered between the ISR and the debouncer (power of two)
+#ifndef BUTTON_EDGE_QUEUE_SIZE
+#define BUTTON_EDGE_QUEUE_SIZE 64
+#endif
+
+enum ButtonId : uint8_t {
+  BUTTON_1,   // BUTTON1_PIN: start/pause
+  BUTTON_2,   // BUTTON2_PIN: toggle/next/reset
+  BUTTON_COUNT
+};
+
+enum ButtonEventType : uint8_t {
+  BUTTON_EVENT_PRESS,
+  BUTTON_EVENT_RELEASE,
+  BUTTON_EVENT_LONG_PRESS,    // still held BUTTON_LONG_PRESS_MS after the press
+  BUTTON_EVENT_DOUBLE_CLICK,  // replaces the PRESS of the second click
+  BUTTON_EVENT_CHORD          // replaces the PRESS of the button that completed both held
+};
+
+struct ButtonEvent {
+  ButtonEventType type;
+  ButtonId button;
+  uint32_t timeUs;  // micros() of the edge (or debounce expiry) behind the event
+};
+
+struct ButtonStats {
+  uint32_t edges;          // raw edges taken by the ISRs
+  uint32_t presses;        // debounced presses (PRESS, DOUBLE_CLICK and CHORD)
+  uint32_t overflows;      // times the edge queue was full (state is resynced from the pins)
+  uint32_t droppedEvents;  // debounced events lost to a full event queue (0 unless the reserve is wrong)
+};
+
+/**
+ * Configures both button pins and attaches their interrupts.
+ */
+void buttons_init();
+
+/**
+ * Runs the debouncer over the queued edges and hands out the next event.
+ * Call in a loop until it returns false.
+ *
+ * @param event Receives the event
+ * @return true if an event was returned
+ */
+bool buttons_next_event(ButtonEvent* event);
+
+/**
+ * Re-reads both pins and queues an edge for any change the interrupts
+ * could not see, e.g. while their GPIOs were armed for light-sleep wakeup.
+ */
+void buttons_resync();
+
+const ButtonStats& buttons_get_stats();
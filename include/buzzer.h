@@ -7,6 +7,11 @@
 #define BUZZER_PIN 13  // Default buzzer pin
 #endif
 
+// LEDC channel that generates the tone (Arduino-ESP32 2.x API)
+#ifndef BUZZER_LEDC_CHANNEL
+#define BUZZER_LEDC_CHANNEL 0
+#endif
+
 /**
  * Initializes the buzzer pin.
  * Must be called before playing any sounds.
@@ -15,8 +20,27 @@
  */
 void buzzer_init(uint8_t pin = BUZZER_PIN);
 
+/**
+ * Advances the sequencer on boards without a hardware step timer.
+ * Call once per loop(); it is a no-op on ESP32.
+ */
+void buzzer_update();
+
+/**
+ * Returns true while a jingle or song is still playing.
+ */
+bool buzzer_is_playing();
+
+/**
+ * Stops the current jingle or song and turns its lights off.
+ */
+void buzzer_stop();
+
 /**
  * Plays a short "happy" jingle variation.
+ *
+ * Like every play function below, this returns immediately; a new sound
+ * replaces whatever is currently playing.
  */
 void buzzer_play_sound_happy1();
 
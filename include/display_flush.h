@@ -0,0 +1,117 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <atomic>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
+
+// Frame-interval codes of the SSD1306 horizontal scroll commands: the
+// scrolled pages move one column every N panel frames
+#define SSD1306_SCROLL_2_FRAMES 0x07
+#define SSD1306_SCROLL_3_FRAMES 0x04
+#define SSD1306_SCROLL_4_FRAMES 0x05
+#define SSD1306_SCROLL_5_FRAMES 0x00
+
+// I2C traffic counters for the display
+struct DisplayFlushStats {
+  uint32_t flushes;         // display() calls
+  uint32_t pagesSent;       // 8-row pages that had to be transmitted
+  uint32_t bytesSent;       // bytes on the wire (address, control, commands, data)
+  uint32_t fullFrameBytes;  // what the same flushes cost as full-frame pushes
+  uint32_t framesDropped;   // queued frames replaced before the bus got to them
+};
+
+// SSD1306 driver that keeps a shadow copy of the frame the panel currently
+// holds. display() compares the framebuffer against it and, per 8-row page,
+// sends only the column range that changed, using the controller's
+// page/column address window. Pages that did not change cost nothing.
+//
+// On the ESP32 the transfer can also run asynchronously: display() then
+// snapshots the framebuffer into a handoff buffer and returns, and a task
+// pinned to the other core streams the snapshot to the panel. Drawing can
+// continue into the framebuffer meanwhile without tearing, because the task
+// only ever sends complete snapshots. If a newer frame arrives before the
+// task picked up the previous one, the older frame is dropped and counted.
+// Without the task (or on other targets) display() blocks as before.
+//
+// The controller can also scroll a band of pages by itself (startScrollLeft).
+// While it does, the panel's RAM must not be written, so display() stops
+// the scroll first, and since the scroll moves the RAM contents, the pages
+// it covered are resent in full by the next flush.
+//
+// display() hides (does not override) Adafruit_SSD1306::display(); callers
+// must hold the display by this type, which is also what RoboEyes is
+// instantiated with.
+class DirtyPageSSD1306 : public Adafruit_SSD1306 {
+public:
+  DirtyPageSSD1306(uint8_t w, uint8_t h, TwoWire* twi = &Wire, int8_t rst_pin = -1);
+  ~DirtyPageSSD1306();
+
+  bool begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0);
+
+  // Push the changed parts of the framebuffer to the panel (or queue them
+  // for the flush task in async mode)
+  void display();
+
+  // Forget the shadow so the next display() sends the whole frame
+  void invalidate();
+
+  // Forget the shadow of pages first..last only
+  void invalidatePages(uint8_t first, uint8_t last);
+
+  // Let the controller rotate pages first..last left by one column every
+  // `interval` (SSD1306 frame-interval code, e.g. SSD1306_SCROLL_3_FRAMES).
+  // Waits for queued frames first.
+  void startScrollLeft(uint8_t first, uint8_t last, uint8_t interval);
+
+  // Stop a running scroll and mark the scrolled pages for resending
+  void stopScroll();
+  bool isScrolling() const { return scrollPages != 0; }
+
+  // Start the flush task on the core loop() is not running on and switch
+  // to async mode. Returns false where that is not available.
+  bool beginAsync();
+
+  // Switch between async and blocking flushes at runtime
+  void setAsync(bool enabled);
+  bool isAsync() const { return asyncEnabled; }
+
+  // Block until every queued frame is on the panel (call before sending
+  // commands to the controller directly while async mode is on)
+  void waitForFlush();
+
+  // Snapshot of the traffic counters (consistent even while the task runs)
+  DisplayFlushStats stats() const;
+
+protected:
+  void flushFrame(const uint8_t* frame);
+  uint32_t sendCommands(const uint8_t* commands, uint8_t count);
+  uint32_t sendData(const uint8_t* data, uint16_t count);
+  void countTraffic(uint32_t pages, uint32_t bytes);
+  void lockFrame() const;
+  void unlockFrame() const;
+
+  uint8_t* shadow;
+  bool shadowValid;
+  // Bit per page, set from loop() and taken by whichever flushFrame() runs next
+  std::atomic<uint8_t> invalidPages;
+  uint8_t scrollPages;            // bit per page the controller is scrolling
+  volatile bool asyncEnabled;
+  DisplayFlushStats flushStats;   // guarded by frameLock once the task exists
+
+#if defined(ESP32)
+  static void flushTask(void* arg);
+
+  uint8_t* handoff;          // latest queued frame (guarded by frameLock)
+  uint8_t* sending;          // frame the task is transmitting
+  bool framePending;         // guarded by frameLock
+  bool flushBusy;            // guarded by frameLock
+  SemaphoreHandle_t frameLock;
+  TaskHandle_t flushTaskHandle;
+#endif
+};
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+#include "pomodoro.h"
+
+// Text formatting for the display and logs.
+//
+// Everything writes into caller-provided buffers or returns pointers to
+// constant tables, so redrawing a screen never touches the heap. Digits
+// come from a two-digit lookup table instead of division per character.
+
+// Buffer size for format_time(): up to "9999:59" and the terminator
+#define FORMAT_TIME_SIZE 8
+
+/**
+ * Writes `seconds` as MM:SS; minutes grow past two digits when needed and
+ * saturate at 9999:59. Output is truncated to fit `size`.
+ *
+ * @return the length written, not counting the terminator
+ */
+size_t format_time(char* out, size_t size, unsigned long seconds);
+
+/**
+ * Display name of a pomodoro state ("Work", "Short Break", ...).
+ */
+const char* format_state_name(PomodoroState state);
@@ -19,6 +19,19 @@ bool gambling_register_choice(GamblingChoice choice, bool* winOut);
 
 void gambling_reset();
 
-// Handle gambling result with display and sound feedback
-// Returns the app mode to return to (MENSA_MENU)
+// Show the result and start its sound; returns at once. The result stays on
+// screen for GAMBLING_RESULT_DISPLAY_MS, ended by gambling_update().
 void gambling_handle_result(GamblingChoice choice, bool win);
+
+// True while a result is on screen
+bool gambling_showing_result();
+
+// Milliseconds until the result screen is due to end (0 when none is shown)
+unsigned long gambling_ms_until_result_end(unsigned long now);
+
+// Ends the result screen once its time is up (call every loop); returns
+// true on the call that ended it
+bool gambling_update(unsigned long now);
+
+// Redraw the intro, or the result while it is shown
+void gambling_show_screen();
@@ -0,0 +1,300 @@
+// Generated by generate_glyph_atlas.py from native/glcdfont.h - do not edit.
+#pragma once
+
+#include <Arduino.h>
+
+// A bitmap in SSD1306 page format: `pages` rows of `width` column bytes,
+// already shifted to the screen rows it is drawn at
+struct AtlasBitmap {
+  uint8_t width;
+  uint8_t firstPage;
+  uint8_t pages;
+  const uint8_t* data;
+};
+
+#define ATLAS_TIMER_Y 22
+#define ATLAS_TIMER_CELL_WIDTH 18
+#define ATLAS_TIMER_CHARS "0123456789:"
+
+// Bits of each page a timer cell owns (rows ATLAS_TIMER_Y onwards)
+static const uint8_t ATLAS_TIMER_PAGE_MASKS[4] = {0xc0, 0xff, 0xff, 0x3f};
+
+static const uint8_t ATLAS_TIMER_0_DATA[] PROGMEM = {  // '0'
+  0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0xfe, 0xfe, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0x71, 0x71, 0x71, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t ATLAS_TIMER_1_DATA[] PROGMEM = {  // '1'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t ATLAS_TIMER_2_DATA[] PROGMEM = {  // '2'
+  0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x0e, 0x0e, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00,
+  0xfc, 0xfc, 0xfc, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+};
+static const uint8_t ATLAS_TIMER_3_DATA[] PROGMEM = {  // '3'
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0xf1, 0xf1, 0xf1, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00,
+  0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t ATLAS_TIMER_4_DATA[] PROGMEM = {  // '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x80, 0x80, 0x70, 0x70, 0x70, 0x0e, 0x0e, 0x0e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x1f, 0x1f, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t ATLAS_TIMER_5_DATA[] PROGMEM = {  // '5'
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+  0x7f, 0x7f, 0x7f, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x81, 0x81, 0x81, 0x00, 0x00, 0x00,
+  0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t ATLAS_TIMER_6_DATA[] PROGMEM = {  // '6'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+  0xf0, 0xf0, 0xf0, 0x8e, 0x8e, 0x8e, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t ATLAS_TIMER_7_DATA[] PROGMEM = {  // '7'
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0x1c, 0x1c, 0x1c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t ATLAS_TIMER_8_DATA[] PROGMEM = {  // '8'
+  0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7e, 0x7e, 0x7e, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00,
+  0xfc, 0xfc, 0xfc, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t ATLAS_TIMER_9_DATA[] PROGMEM = {  // '9'
+  0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7e, 0x7e, 0x7e, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xe3, 0xe3, 0xe3, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t ATLAS_TIMER_COLON_DATA[] PROGMEM = {  // ':'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Indexed by position in ATLAS_TIMER_CHARS
+static const AtlasBitmap ATLAS_TIMER_GLYPHS[] = {
+  {18, 2, 4, ATLAS_TIMER_0_DATA},
+  {18, 2, 4, ATLAS_TIMER_1_DATA},
+  {18, 2, 4, ATLAS_TIMER_2_DATA},
+  {18, 2, 4, ATLAS_TIMER_3_DATA},
+  {18, 2, 4, ATLAS_TIMER_4_DATA},
+  {18, 2, 4, ATLAS_TIMER_5_DATA},
+  {18, 2, 4, ATLAS_TIMER_6_DATA},
+  {18, 2, 4, ATLAS_TIMER_7_DATA},
+  {18, 2, 4, ATLAS_TIMER_8_DATA},
+  {18, 2, 4, ATLAS_TIMER_9_DATA},
+  {18, 2, 4, ATLAS_TIMER_COLON_DATA},
+};
+
+#define ATLAS_LABEL_WORK_Y 2
+static const uint8_t ATLAS_LABEL_WORK_DATA[] PROGMEM = {  // "WORK"
+  0xfc, 0x00, 0xe0, 0x00, 0xfc, 0x00, 0xf8, 0x04, 0x04, 0x04, 0xf8, 0x00, 0xfc, 0x24, 0x64, 0xa4, 0x18, 0x00, 0xfc, 0x20, 0x50, 0x88, 0x04, 0x00,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+};
+static const AtlasBitmap ATLAS_LABEL_WORK = {24, 0, 2, ATLAS_LABEL_WORK_DATA};
+
+#define ATLAS_LABEL_BREAK_Y 2
+static const uint8_t ATLAS_LABEL_BREAK_DATA[] PROGMEM = {  // "BREAK"
+  0xfc, 0x24, 0x24, 0x24, 0xd8, 0x00, 0xfc, 0x24, 0x64, 0xa4, 0x18, 0x00, 0xfc, 0x24, 0x24, 0x24, 0x04, 0x00, 0xf0, 0x48, 0x44, 0x48, 0xf0, 0x00, 0xfc, 0x20, 0x50, 0x88, 0x04, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+};
+static const AtlasBitmap ATLAS_LABEL_BREAK = {30, 0, 2, ATLAS_LABEL_BREAK_DATA};
+
+#define ATLAS_LABEL_COMPLETED_Y 52
+static const uint8_t ATLAS_LABEL_COMPLETED_DATA[] PROGMEM = {  // "Completed: "
+  0xe0, 0x10, 0x10, 0x10, 0x20, 0x00, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0xc0, 0x40, 0x80, 0x40, 0x80, 0x00, 0xc0, 0x80, 0x40, 0x40, 0x80, 0x00, 0x00, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x40, 0x40, 0xf0, 0x40, 0x40, 0x00, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x80, 0x40, 0x40, 0x80, 0xf0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x04, 0x04, 0x04, 0x02, 0x00, 0x03, 0x04, 0x04, 0x04, 0x03, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0f, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x04, 0x07, 0x04, 0x00, 0x00, 0x03, 0x05, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00, 0x03, 0x04, 0x02, 0x00, 0x03, 0x05, 0x05, 0x05, 0x01, 0x00, 0x03, 0x04, 0x04, 0x02, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const AtlasBitmap ATLAS_LABEL_COMPLETED = {66, 6, 2, ATLAS_LABEL_COMPLETED_DATA};
+
+// Column range of one message in ATLAS_BANNER_STRIP
+struct AtlasSpan {
+  uint16_t offset;
+  uint16_t width;
+};
+
+#define ATLAS_BANNER_COUNT 10
+// bannerMessages[] from src/monitor.cpp, one byte per column (LSB at the
+// top row of the text)
+static const uint8_t ATLAS_BANNER_STRIP[3318] PROGMEM = {
+  // "The secret of getting ahead is getting started - Mark Twain"
+  0x03, 0x01, 0x7f, 0x01, 0x03, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+  0x00, 0x08, 0x7e, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x02, 0x1c, 0x02, 0x7f, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00,
+  0x7f, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7f, 0x01, 0x03, 0x00, 0x3c, 0x40, 0x30, 0x40, 0x3c, 0x00,
+  0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  // "Don't watch the clock; do what it does. Keep going - Sam Levenson"
+  0x7f, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x08, 0x07, 0x03, 0x00, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x30, 0x40, 0x3c, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00,
+  0x7f, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x40, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x30, 0x40, 0x3c, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0x08, 0x14, 0x22, 0x41, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0xfc, 0x18, 0x24, 0x24, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x49, 0x49, 0x49, 0x32, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x7c, 0x04, 0x78, 0x04, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x40, 0x40, 0x40, 0x40, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  // "The way to get started is to quit talking and begin doing - Walt Disney"
+  0x03, 0x01, 0x7f, 0x01, 0x03, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3c, 0x40, 0x30, 0x40, 0x3c, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x4c, 0x90, 0x90, 0x90, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x18, 0xfc, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00,
+  0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x7f, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x28, 0x44, 0x44, 0x38, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00,
+  0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x40, 0x38, 0x40, 0x3f, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x4c, 0x90, 0x90, 0x90, 0x7c, 0x00,
+  // "It always seems impossible until it's done - Nelson Mandela"
+  0x00, 0x41, 0x7f, 0x41, 0x00, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00,
+  0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x3c, 0x40, 0x30, 0x40, 0x3c, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x4c, 0x90, 0x90, 0x90, 0x7c, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x7c, 0x04, 0x78, 0x04, 0x78, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x04, 0x78, 0x04, 0x78, 0x00, 0xfc, 0x18, 0x24, 0x24, 0x18, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7f, 0x28, 0x44, 0x44, 0x38, 0x00,
+  0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x08, 0x07, 0x03, 0x00, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x04, 0x08, 0x10, 0x7f, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0x02, 0x1c, 0x02, 0x7f, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00,
+  // "Success is not final, failure is not fatal - Winston Churchill"
+  0x26, 0x49, 0x49, 0x49, 0x32, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7e, 0x09, 0x02, 0x00,
+  0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,
+  0x00, 0x80, 0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7e, 0x09, 0x02, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00,
+  0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7e, 0x09, 0x02, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+  0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x40, 0x38, 0x40, 0x3f, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x41, 0x41, 0x41, 0x22, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,
+  // "Believe you can and you're halfway there - Theodore Roosevelt"
+  0x7f, 0x49, 0x49, 0x49, 0x36, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4c, 0x90, 0x90, 0x90, 0x7c, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4c, 0x90, 0x90, 0x90, 0x7c, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00, 0x00, 0x08, 0x07, 0x03, 0x00, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x08, 0x7e, 0x09, 0x02, 0x00, 0x3c, 0x40, 0x30, 0x40, 0x3c, 0x00,
+  0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x4c, 0x90, 0x90, 0x90, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+  0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x7f, 0x01, 0x03, 0x00,
+  0x7f, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0x09, 0x19, 0x29, 0x46, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+  // "Action is the foundational key to all success - Pablo Picasso"
+  0x7c, 0x12, 0x11, 0x12, 0x7c, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7e, 0x09, 0x02, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+  0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x10, 0x28, 0x44, 0x00, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x4c, 0x90, 0x90, 0x90, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,
+  0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0x09, 0x09, 0x09, 0x06, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x7f, 0x28, 0x44, 0x44, 0x38, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+  // "Small progress is still progress"
+  0x26, 0x49, 0x49, 0x49, 0x32, 0x00, 0x7c, 0x04, 0x78, 0x04, 0x78, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,
+  0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x18, 0x24, 0x24, 0x18, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+  0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfc, 0x18, 0x24, 0x24, 0x18, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+  // "Focus on being productive instead of busy"
+  0x7f, 0x09, 0x09, 0x09, 0x01, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x28, 0x44, 0x44, 0x38, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x18, 0x24, 0x24, 0x18, 0x00,
+  0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x48, 0x54, 0x54, 0x54, 0x24, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00,
+  0x38, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x08, 0x7e, 0x09, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x28, 0x44, 0x44, 0x38, 0x00, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+  0x4c, 0x90, 0x90, 0x90, 0x7c, 0x00,
+  // "Great things never come from comfort zones"
+  0x3e, 0x41, 0x41, 0x51, 0x73, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x20, 0x54, 0x54, 0x78, 0x40, 0x00,
+  0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00, 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x18, 0xa4, 0xa4, 0x9c, 0x78, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00,
+  0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x04, 0x78, 0x04, 0x78, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x7e, 0x09, 0x02, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x04, 0x78, 0x04, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x04, 0x78, 0x04, 0x78, 0x00,
+  0x00, 0x08, 0x7e, 0x09, 0x02, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00, 0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x64, 0x54, 0x4c, 0x44, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+  0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+};
+static const AtlasSpan ATLAS_BANNER_SPANS[ATLAS_BANNER_COUNT] = {
+  {0, 354},
+  {354, 390},
+  {744, 426},
+  {1170, 354},
+  {1524, 372},
+  {1896, 366},
+  {2262, 366},
+  {2628, 192},
+  {2820, 246},
+  {3066, 252},
+};
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Session history.
+//
+// Every finished or abandoned session is appended as an 8-byte record to a
+// ring log in its own flash partition ("history" in partitions.csv). The
+// log is split into 4 KB sectors, each starting with a sequence-numbered
+// header; when the head sector is full the oldest one is erased and reused.
+// At boot only the sector headers and a binary search of the newest sector
+// are read, so finding the head does not depend on how full the log is.
+//
+// Focus totals for today and the last 7 days are kept as running sums over
+// a small per-day table, updated on append. Queries read the sums and
+// never touch the log.
+//
+// Times are device minutes: minutes of uptime, continued from the newest
+// record after a reboot. There is no wall clock, so time spent powered off
+// is not counted and "today" is the current 1440-minute device day.
+
+// Sector size of the log (the flash erase unit)
+#define HISTORY_SECTOR_SIZE 4096
+
+// Days covered by the rolling total (today included)
+#define HISTORY_WINDOW_DAYS 7
+
+// Host builds keep the log in a RAM image of this size (~131k records)
+#ifndef HISTORY_HOST_FLASH_SIZE
+#define HISTORY_HOST_FLASH_SIZE (1024UL * 1024UL)
+#endif
+
+enum HistoryKind : uint8_t {
+  HISTORY_WORK,
+  HISTORY_SHORT_BREAK,
+  HISTORY_LONG_BREAK
+};
+
+// One session, packed. Erased flash (all ones) is never a valid record,
+// since startMinute never reaches 0xFFFFFF (~32 years of device time).
+struct HistoryRecord {
+  uint32_t startMinute : 24;    // device minute the session started
+  uint32_t kind : 2;            // HistoryKind
+  uint32_t completed : 1;       // ran to the end (else reset)
+  uint32_t pauses : 5;          // saturates at 31
+  uint16_t actualSeconds;       // time spent counting down
+  uint8_t plannedMinutes;
+  uint8_t presenceLosses;       // saturates at 255
+};
+
+static_assert(sizeof(HistoryRecord) == 8, "history records are 8 bytes");
+
+struct HistoryTotals {
+  uint32_t todayFocusSeconds;   // work sessions only
+  uint16_t todaySessions;       // work sessions started today
+  uint32_t weekFocusSeconds;    // last HISTORY_WINDOW_DAYS days
+  uint16_t weekSessions;
+  uint32_t records;             // records currently in the log
+};
+
+/**
+ * Finds the log partition, locates its head and rebuilds the rolling
+ * totals from the records inside the window.
+ *
+ * @return false if there is no usable history partition
+ */
+bool history_init();
+
+/**
+ * Minutes of device time (see above).
+ */
+uint32_t history_now_minutes();
+
+/**
+ * Session tracking, driven by the pomodoro module. A session that was
+ * already running (e.g. restored after a reset) passes the seconds it has
+ * counted down so far.
+ */
+void history_session_begin(HistoryKind kind, uint32_t plannedSeconds, uint32_t elapsedSeconds = 0);
+void history_session_pause();
+void history_session_presence_lost();
+
+/**
+ * Ends the current session and appends its record.
+ *
+ * @param completed        true if the countdown reached zero
+ * @param remainingSeconds time that was still left (0 when completed)
+ */
+void history_session_end(bool completed, uint32_t remainingSeconds);
+
+/**
+ * Appends a record directly and folds it into the totals.
+ */
+bool history_append(const HistoryRecord& record);
+
+/**
+ * Totals for today and the rolling window. O(1).
+ */
+void history_get_totals(HistoryTotals* totals);
+
+/**
+ * Reads the `index`-th newest record (0 = newest). O(1).
+ *
+ * @return false if the log holds fewer records
+ */
+bool history_read(uint32_t index, HistoryRecord* record);
+
+/**
+ * Erases the whole log and the totals.
+ */
+void history_clear();
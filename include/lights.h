@@ -8,6 +8,7 @@
 
 // Function declarations
 void lights_init();
+bool lights_update();
 void light_green_on();
 void light_green_off();
 void light_red_on();
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Leveled, per-module logging.
+//
+// A message below the compile-time threshold of its module is removed by
+// the compiler: LOG_x() expands to a branch on a constexpr condition, so
+// neither the call nor its arguments survive. Enabled messages are
+// formatted into a ring buffer and return immediately; the UART
+// is fed from the buffer by a low-priority task on ESP32, or by
+// log_update() from loop() elsewhere. When the buffer is full the message
+// is dropped and counted instead of stalling the caller.
+//
+// Any task may log (the menu fetch runs in its own task); writers take a
+// short spinlock around the copy into the ring. Not from ISRs.
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+// Global threshold, e.g. -DLOG_LEVEL=LOG_LEVEL_WARN; LOG_LEVEL_NONE
+// compiles every message out
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// Per-module thresholds default to the global one
+#ifndef LOG_LEVEL_APP
+#define LOG_LEVEL_APP LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_POMODORO
+#define LOG_LEVEL_POMODORO LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_ULTRASOUND
+#define LOG_LEVEL_ULTRASOUND LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_REQUEST
+#define LOG_LEVEL_REQUEST LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_GAMBLING
+#define LOG_LEVEL_GAMBLING LOG_LEVEL
+#endif
+#ifndef LOG_LEVEL_HARDWARE
+#define LOG_LEVEL_HARDWARE LOG_LEVEL
+#endif
+
+// Bytes of formatted text buffered between the caller and the UART (a power
+// of two)
+#ifndef LOG_BUFFER_SIZE
+#define LOG_BUFFER_SIZE 2048
+#endif
+
+// Longest single message, prefix included; longer text is truncated
+#define LOG_LINE_MAX 160
+
+enum LogModule : uint8_t {
+  LOG_APP,         // main.cpp: buttons, modes, setup
+  LOG_POMODORO,
+  LOG_ULTRASOUND,
+  LOG_REQUEST,     // WiFi and the Mensa menu
+  LOG_GAMBLING,
+  LOG_HARDWARE     // display, lights, buzzer
+};
+
+constexpr int log_module_threshold(LogModule module) {
+  return module == LOG_APP ? LOG_LEVEL_APP :
+         module == LOG_POMODORO ? LOG_LEVEL_POMODORO :
+         module == LOG_ULTRASOUND ? LOG_LEVEL_ULTRASOUND :
+         module == LOG_REQUEST ? LOG_LEVEL_REQUEST :
+         module == LOG_GAMBLING ? LOG_LEVEL_GAMBLING :
+         LOG_LEVEL_HARDWARE;
+}
+
+constexpr bool log_enabled(int level, LogModule module) {
+  return level <= log_module_threshold(module);
+}
+
+/**
+ * Starts the drain task (ESP32). Call after Serial.begin().
+ */
+void log_init();
+
+/**
+ * Moves buffered text to the UART as far as it accepts it without
+ * blocking. Needed on targets without the drain task; a no-op on ESP32.
+ */
+void log_update();
+
+/**
+ * Formats one message (printf syntax) and queues it with a
+ * "[millis][L][module] " prefix. Use the LOG_x() macros instead, so that
+ * disabled messages are compiled out.
+ */
+void log_write(int level, LogModule module, const char* format, ...)
+    __attribute__((format(printf, 3, 4)));
+
+/**
+ * Number of messages dropped because the buffer was full.
+ */
+uint32_t log_dropped_count();
+
+/**
+ * Bytes currently free in the buffer. Bulk output (reports) can wait for
+ * LOG_LINE_MAX bytes of room before each line so nothing is dropped.
+ */
+size_t log_buffer_free();
+
+#define LOG_AT(level, module, ...)                     \
+  do {                                                 \
+    if (log_enabled((level), (module))) {              \
+      log_write((level), (module), __VA_ARGS__);       \
+    }                                                  \
+  } while (0)
+
+#define LOG_E(module, ...) LOG_AT(LOG_LEVEL_ERROR, module, __VA_ARGS__)
+#define LOG_W(module, ...) LOG_AT(LOG_LEVEL_WARN, module, __VA_ARGS__)
+#define LOG_I(module, ...) LOG_AT(LOG_LEVEL_INFO, module, __VA_ARGS__)
+#define LOG_D(module, ...) LOG_AT(LOG_LEVEL_DEBUG, module, __VA_ARGS__)
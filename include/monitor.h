@@ -7,6 +7,7 @@
 #include "pomodoro.h"
 #include "gambling.h"
 #include "config.h"
+#include "display_flush.h"
 
 // Display settings
 #define SCREEN_WIDTH 128
@@ -14,6 +15,31 @@
 #define OLED_RESET -1
 #define SCREEN_ADDRESS 0x3C
 
+// Stream frames to the panel from a task on the other core (ESP32 only).
+// Set to 0 to keep the blocking display() path.
+#ifndef MONITOR_ASYNC_FLUSH
+#define MONITOR_ASYNC_FLUSH 1
+#endif
+
+// Let the panel controller scroll the idle-screen banner in hardware instead
+// of redrawing it every 50 ms (see monitor.cpp). Can be switched at runtime
+// with monitor_set_banner_hardware_scroll().
+#ifndef MONITOR_BANNER_HW_SCROLL
+#define MONITOR_BANNER_HW_SCROLL 0
+#endif
+
+// Rasterization work of the idle and running screens, which redraw only
+// the widgets whose value changed
+struct MonitorRenderStats {
+  uint32_t updates;       // monitor_show_idle/running_screen() calls
+  uint32_t composed;      // full redraws after another screen was shown
+  uint32_t rasterized;    // updates that drew anything (and flushed)
+  uint32_t widgetsDrawn;
+  uint32_t rasterUs;      // time spent drawing in those updates
+  uint32_t bannerDraws;   // idle-screen ticker frames drawn
+  uint32_t bannerUs;      // time spent drawing them
+};
+
 // Mode selection (when idle)
 enum IdleMode {
   MODE_WORK,
@@ -28,14 +54,36 @@ void monitor_show_idle_screen(IdleMode selectedMode, int completedCount);
 void monitor_show_running_screen(PomodoroState state, unsigned long timeRemaining, int completedCount);
 void monitor_show_finished_screen(int completedCount);
 void monitor_show_boot_screen();
-void monitor_show_mensa_menu(int currentIndex, int totalItems);
+// Draws item currentIndex (clamped) of the menu published right now
+void monitor_show_mensa_menu(int currentIndex);
 void monitor_gambling_show_intro();
 void monitor_gambling_show_result(GamblingChoice choice, bool win);
 void monitor_show_time_adjustment(const char* label, int minutes);
 
 // Utility functions
-String monitor_format_time(unsigned long seconds);
-const char* monitor_get_banner_message();
+// Idle-screen banner message `index`, or nullptr past the last one
+const char* monitor_get_banner_message(int index);
+
+MonitorRenderStats monitor_get_render_stats();
+
+// Bytes sent to the panel vs. what full-frame flushes would have cost
+DisplayFlushStats monitor_get_flush_stats();
+
+// Switch between the background flush task and blocking flushes
+void monitor_set_async_flush(bool enabled);
+
+// Block until queued frames are on the panel (before sleeping)
+void monitor_wait_for_flush();
+
+// Milliseconds until the idle-screen banner next moves (0 = redraw now)
+unsigned long monitor_banner_ms_until_change(unsigned long now);
+
+// Switch the banner between hardware and software scrolling. Enabling takes
+// effect at the next message; disabling at once.
+void monitor_set_banner_hardware_scroll(bool enabled);
+
+// True while the controller is scrolling the banner
+bool monitor_banner_hardware_scroll_active();
 
 // Show meme image
 void monitor_show_meme();
@@ -44,10 +92,19 @@ void monitor_show_meme();
 void monitor_roboeyes_init();
 void monitor_roboeyes_show_happy();
 void monitor_roboeyes_show_sad();
+void monitor_roboeyes_animate(int duration_ms);
+
+// RoboEyes sequences - these only start playback and return immediately;
+// the frames are drawn by monitor_animation_update()
 void monitor_roboeyes_show_init();
 void monitor_roboeyes_show_lost();
 void monitor_roboeyes_show_return();
 void monitor_roboeyes_show_shake();
-void monitor_roboeyes_animate(int duration_ms);
+
+// Animation playback (call monitor_animation_update() every loop).
+// Drawing any other screen stops the running sequence.
+bool monitor_animation_update();
+bool monitor_animation_is_active();
+void monitor_animation_stop();
 
 #endif
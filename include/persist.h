@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+#include "pomodoro.h"
+
+// Pomodoro state persistence in NVS.
+//
+// persist_update() compares the live pomodoro snapshot with the one last
+// written and decides when flash is worth touching:
+//
+//  - a transition (start, pause, finish, reset, new durations) is written
+//    promptly, but never sooner than PERSIST_MIN_WRITE_GAP_MS after the
+//    previous write, so a burst of changes coalesces into one write
+//  - a running countdown is re-saved only every PERSIST_PROGRESS_INTERVAL_MS
+//
+// After a reset the session resumes from the last snapshot, so it loses at
+// most PERSIST_PROGRESS_INTERVAL_MS of progress (plus the reboot itself).
+// A session running around the clock costs about 86400 s divided by that
+// interval in writes per day; NVS spreads them over its pages.
+
+#ifndef PERSIST_MIN_WRITE_GAP_MS
+#define PERSIST_MIN_WRITE_GAP_MS 2000UL
+#endif
+
+#ifndef PERSIST_PROGRESS_INTERVAL_MS
+#define PERSIST_PROGRESS_INTERVAL_MS 60000UL
+#endif
+
+struct PersistStats {
+  uint32_t writes;      // snapshots written to flash
+  uint32_t coalesced;   // changes folded into a later write
+};
+
+/**
+ * Opens the NVS namespace. Call before persist_load_pomodoro().
+ */
+void persist_init();
+
+/**
+ * Reads the last saved snapshot.
+ *
+ * @return false if there is none or it was written by an incompatible build
+ */
+bool persist_load_pomodoro(PomodoroSnapshot* snapshot);
+
+/**
+ * Writes the pomodoro snapshot if the rules above say so. Cheap when
+ * nothing is due; call once per loop().
+ */
+void persist_update(unsigned long now);
+
+/**
+ * Milliseconds until persist_update() has a write due, for idle scheduling.
+ * PERSIST_PROGRESS_INTERVAL_MS or more when nothing is pending.
+ */
+unsigned long persist_ms_until_write(unsigned long now);
+
+const PersistStats& persist_get_stats();
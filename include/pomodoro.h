@@ -18,9 +18,28 @@ enum PomodoroState {
 #define LONG_BREAK_DURATION 900  // 15 minutes
 #define POMODOROS_UNTIL_LONG_BREAK 4
 
+// Everything needed to carry a session across a reboot. A running session
+// is captured as its remaining time: the monotonic clock restarts at boot.
+struct PomodoroSnapshot {
+  uint8_t state;               // PomodoroState
+  uint8_t pausedSourceState;   // PomodoroState the pause interrupted
+  uint16_t completedCount;
+  uint32_t remainingMs;        // running or paused session, else 0
+  uint32_t workDuration;       // seconds
+  uint32_t shortBreakDuration;
+  uint32_t longBreakDuration;
+};
+
 // Initialize the pomodoro timer
 void pomodoro_init();
 
+// Capture the current state, durations and count
+void pomodoro_get_snapshot(PomodoroSnapshot* snapshot);
+
+// Continue from a snapshot; a running session resumes counting down at once.
+// Returns false (and changes nothing) if the snapshot is not valid.
+bool pomodoro_restore(const PomodoroSnapshot& snapshot);
+
 // Start a work session
 void pomodoro_start_work();
 
@@ -51,9 +70,6 @@ int pomodoro_get_completed_count();
 // Check if timer has finished
 bool pomodoro_is_finished();
 
-// Get state as string
-String pomodoro_get_state_string();
-
 // Duration configuration helpers (seconds)
 void pomodoro_set_work_duration(unsigned long seconds);
 void pomodoro_set_short_break_duration(unsigned long seconds);
@@ -67,7 +83,11 @@ void pomodoro_set_time_remaining(unsigned long seconds);
 bool pomodoro_is_running();
 PomodoroState pomodoro_get_paused_source_state();
 
-// Format time as MM:SS
-String pomodoro_format_time(unsigned long seconds);
+// Absolute end of the running session on the monotonic microsecond clock
+// (esp_timer_get_time() on the ESP32), or 0 when not running
+int64_t pomodoro_get_deadline_us();
+
+// Milliseconds until the running session ends (rounded up), or 0 when not running
+unsigned long pomodoro_get_ms_until_deadline();
 
 #endif
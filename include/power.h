@@ -0,0 +1,88 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Power management.
+//
+// loop() used to wake every 10 ms whatever was going on. Instead it now
+// works out when it next has something to do (timer end, next display
+// refresh, next ultrasound ping, double-click window) and hands that to
+// power_idle(), which waits for it in the cheapest way available:
+//
+//  - light sleep (CPU clock gated, RAM kept) when the caller says nothing
+//    needs the CPU in the meantime; the wake pins end it early
+//  - otherwise a blocking wait on a task notification, which an input
+//    interrupt cuts short via power_wake_from_isr()
+//
+// With ESP-IDF power management available (CONFIG_PM_ENABLE), the CPU
+// clock is also scaled down to POWER_MIN_CPU_MHZ whenever no task needs it.
+
+// Never sleep longer than this, so housekeeping keeps running
+#ifndef POWER_MAX_SLEEP_MS
+#define POWER_MAX_SLEEP_MS 1000
+#endif
+
+// Shorter idle stretches are not worth the light sleep entry/exit cost
+#ifndef POWER_LIGHT_SLEEP_MIN_MS
+#define POWER_LIGHT_SLEEP_MIN_MS 20
+#endif
+
+// Dynamic frequency scaling range
+#ifndef POWER_MAX_CPU_MHZ
+#define POWER_MAX_CPU_MHZ 240
+#endif
+#ifndef POWER_MIN_CPU_MHZ
+#define POWER_MIN_CPU_MHZ 80
+#endif
+
+// Rough ESP32 module current draw (radio off) used for the estimate; the
+// display, LEDs and buzzer come on top
+#define POWER_ACTIVE_MA 50.0f       // running at POWER_MAX_CPU_MHZ
+#define POWER_WAIT_MA 20.0f         // idle task, clock scaled down
+#define POWER_LIGHT_SLEEP_MA 0.8f
+
+struct PowerStats {
+  uint32_t wakeups;       // times power_idle() returned
+  uint64_t activeUs;      // time between power_idle() calls
+  uint64_t waitUs;        // time blocked in power_idle() while awake
+  uint64_t lightSleepUs;  // time spent in light sleep
+};
+
+/**
+ * Sets up frequency scaling (where available) and remembers the calling
+ * task as the one power_wake_from_isr() wakes. Call from setup().
+ */
+void power_init();
+
+/**
+ * Registers an input that ends light sleep when it goes LOW.
+ *
+ * @param pin           Active-low input pin
+ * @param interruptMode The mode its attachInterrupt() uses (CHANGE, FALLING, ...),
+ *                      restored after each sleep
+ */
+void power_add_wake_pin(uint8_t pin, int interruptMode);
+
+/**
+ * Waits up to `sleepMs` (capped at POWER_MAX_SLEEP_MS).
+ *
+ * @param sleepMs         Time until the caller's next deadline
+ * @param allowLightSleep True when nothing (radio, sound, pending output)
+ *                        needs the CPU or clocks until then
+ * @return The wake pin that ended a light sleep, or -1. Edges during the
+ *         sleep were not seen by the pins' interrupts.
+ */
+int power_idle(uint32_t sleepMs, bool allowLightSleep);
+
+/**
+ * Ends a power_idle() wait early. Safe to call from an ISR.
+ */
+void power_wake_from_isr();
+
+const PowerStats& power_get_stats();
+
+/**
+ * Wakeups per second and estimated module current, averaged since boot.
+ */
+float power_wakeups_per_second();
+float power_estimated_ma();
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Loop profiler.
+//
+// Each handler loop() calls is timed with the CPU cycle counter (ESP32) or
+// micros() elsewhere and filed into a fixed-bucket latency histogram. The
+// whole iteration is tracked the same way, together with the slowest
+// iteration seen and the handler that dominated it.
+//
+// Send "prof" over the serial monitor to dump the tables, "prof reset" to
+// clear them. The report goes out through the log buffer one line per
+// loop() iteration, so printing it never stalls the loop either.
+//
+// Build with -DPROFILER_ENABLED=0 to compile all of it out.
+
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+// Histogram bucket upper bounds in microseconds; the last bucket is open
+#define PROFILER_BUCKET_BOUNDS_US {100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000}
+#define PROFILER_BUCKETS 10
+
+enum ProfileSection : uint8_t {
+  PROF_POMODORO,
+  PROF_BUTTONS,        // settings shake block, button events, double-click timeout
+  PROF_TIMER_COMPLETION,
+  PROF_ULTRASOUND,     // ultrasound_update + handleUltrasoundMonitoring
+  PROF_SHAKING,
+  PROF_WIFI,
+  PROF_ANIMATION,
+  PROF_DISPLAY,
+  PROF_BUZZER,
+  PROF_LOG,
+  PROF_BOOT,           // boot stages still running after setup()
+  PROF_PERSIST,
+  PROF_SECTION_COUNT
+};
+
+struct ProfileStats {
+  uint32_t count;
+  uint32_t maxUs;
+  uint64_t totalUs;
+  uint32_t buckets[PROFILER_BUCKETS];
+};
+
+struct LoopProfile {
+  ProfileStats loop;            // loop() body, excluding the trailing delay
+  uint32_t worstLoopAtMs;       // millis() when the slowest iteration started
+  ProfileSection worstLoopCulprit;  // slowest handler in that iteration
+  uint32_t worstCulpritUs;
+  ProfileStats inputLatency;    // button edge to the end of its action
+};
+
+#if PROFILER_ENABLED
+
+/**
+ * Calibrates the cycle counter. Call once in setup().
+ */
+void profiler_init();
+
+/**
+ * Marks the start and end of one loop() iteration.
+ */
+void profiler_loop_begin();
+void profiler_loop_end();
+
+/**
+ * Timestamp for profiler_record(), in profiler ticks.
+ */
+uint32_t profiler_now();
+
+/**
+ * Files the time since `startTicks` under `section`.
+ */
+void profiler_record(ProfileSection section, uint32_t startTicks);
+
+/**
+ * Files one input-to-action latency in microseconds.
+ */
+void profiler_record_latency(uint32_t us);
+
+/**
+ * Polls the serial port for commands and emits pending report lines.
+ * Never blocks; call once per loop().
+ */
+void profiler_update();
+
+/**
+ * Clears every histogram and the worst-loop record.
+ */
+void profiler_reset();
+
+/**
+ * True while a requested report is still being written out.
+ */
+bool profiler_is_reporting();
+
+const ProfileStats& profiler_get_section(ProfileSection section);
+const LoopProfile& profiler_get_loop();
+const char* profiler_section_name(ProfileSection section);
+
+// Times one handler call: PROFILE_CALL(PROF_DISPLAY, updateDisplay(now, state));
+#define PROFILE_CALL(section, call)             \
+  do {                                          \
+    uint32_t profileStart_ = profiler_now();    \
+    call;                                       \
+    profiler_record((section), profileStart_);  \
+  } while (0)
+
+#else
+
+// Compiled out: the same API, recording nothing and reading back zeros
+inline void profiler_init() {}
+inline void profiler_loop_begin() {}
+inline void profiler_loop_end() {}
+inline uint32_t profiler_now() { return 0; }
+inline void profiler_record(ProfileSection, uint32_t) {}
+inline void profiler_record_latency(uint32_t) {}
+inline void profiler_update() {}
+inline void profiler_reset() {}
+inline bool profiler_is_reporting() { return false; }
+
+inline const ProfileStats& profiler_get_section(ProfileSection) {
+  static const ProfileStats none = {};
+  return none;
+}
+
+inline const LoopProfile& profiler_get_loop() {
+  static const LoopProfile none = {};
+  return none;
+}
+
+inline const char* profiler_section_name(ProfileSection) { return ""; }
+
+#define PROFILE_CALL(section, call) \
+  do {                              \
+    call;                           \
+  } while (0)
+
+#endif
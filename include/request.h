@@ -5,24 +5,86 @@
 // Maximum number of menu items to store
 #define MAX_MENU_ITEMS 20
 
-// Structure to hold a single menu item
+// Bytes of menu text kept per fetch (two such arenas are reserved statically)
+#ifndef MENU_ARENA_SIZE
+#define MENU_ARENA_SIZE 3072
+#endif
+
+// WiFi connection timing
+#ifndef WIFI_ATTEMPT_TIMEOUT_MS
+#define WIFI_ATTEMPT_TIMEOUT_MS 15000UL  // give up on one association attempt
+#endif
+#ifndef WIFI_BACKOFF_MIN_MS
+#define WIFI_BACKOFF_MIN_MS 2000UL       // wait after the first failed attempt
+#endif
+#ifndef WIFI_BACKOFF_MAX_MS
+#define WIFI_BACKOFF_MAX_MS 60000UL      // cap for the doubling wait
+#endif
+#ifndef WIFI_MAX_ATTEMPTS
+#define WIFI_MAX_ATTEMPTS 6              // attempts before WIFI_CONN_FAILED
+#endif
+#ifndef WIFI_RETRY_INTERVAL_MS
+#define WIFI_RETRY_INTERVAL_MS 600000UL  // radio off after a failed series, then try again
+#endif
+
+// WiFi connection state machine, advanced by request_update()
+enum WifiConnectionState {
+  WIFI_CONN_IDLE,        // request_begin() not called yet
+  WIFI_CONN_CONNECTING,  // association attempt in progress
+  WIFI_CONN_CONNECTED,
+  WIFI_CONN_BACKOFF,     // waiting before the next attempt
+  WIFI_CONN_FAILED       // out of attempts; radio off for WIFI_RETRY_INTERVAL_MS
+};
+
+// Structure to hold a single menu item. The strings point into the menu
+// arena and stay valid until the next successful fetch replaces the menu.
 struct MensaMenuItem {
-  String date;
-  String weekday;
-  String title;
-  String price_chf;
-  String source;
+  const char* date;
+  const char* weekday;
+  const char* title;
+  const char* price_chf;
+  const char* source;
 };
 
 /**
- * Initializes the WiFi connection and HTTP client for making requests.
- * Must be called before using any other request functions.
+ * Starts connecting to WiFi in the background and returns immediately.
+ * Must be called before using any other request functions. The strings
+ * must stay valid for as long as the connection is managed.
  *
  * @param ssid WiFi network name
  * @param password WiFi password
- * @return true if WiFi connected successfully, false otherwise
  */
-bool request_init(const char* ssid, const char* password);
+void request_begin(const char* ssid, const char* password);
+
+/**
+ * Advances the WiFi state machine: detects the connection, times out
+ * attempts, backs off exponentially between them, reconnects after a lost
+ * link and starts a new series WIFI_RETRY_INTERVAL_MS after one failed.
+ * Call once per loop().
+ *
+ * @return the current connection state
+ */
+WifiConnectionState request_update();
+
+/**
+ * Starts a fresh series of connection attempts after WIFI_CONN_FAILED
+ * without waiting for the retry interval.
+ */
+void request_reconnect();
+
+/**
+ * Milliseconds until WIFI_CONN_FAILED starts its next series of attempts
+ * (0 = due now). In any other state request_update() is polled while the
+ * radio is on, and this returns the whole retry interval.
+ */
+unsigned long request_ms_until_wifi_retry(unsigned long now);
+
+/**
+ * Gets the current WiFi connection state.
+ *
+ * @return the state last computed by request_update()
+ */
+WifiConnectionState request_get_wifi_state();
 
 /**
  * Fetches the mensa menu from mensa-hsg.vercel.com/menu.json
@@ -32,6 +94,30 @@ bool request_init(const char* ssid, const char* password);
  */
 bool request_fetch_mensa_menu();
 
+/**
+ * Starts request_fetch_mensa_menu() without waiting for it: in a
+ * background task on ESP32, inline elsewhere. The menu on display stays
+ * valid throughout, since a fetch only swaps in the new one when complete.
+ *
+ * @return true if a fetch was started, false if one is still running
+ */
+bool request_start_menu_fetch();
+
+/**
+ * Checks if a background fetch is in progress.
+ *
+ * @return true between request_start_menu_fetch() and its completion
+ */
+bool request_menu_fetch_running();
+
+/**
+ * Reports a finished background fetch, once.
+ *
+ * @param ok Receives whether the fetch succeeded (may be nullptr)
+ * @return true once per completed fetch
+ */
+bool request_menu_fetch_finished(bool* ok);
+
 /**
  * Checks if WiFi is currently connected.
  *
@@ -46,12 +132,22 @@ bool request_is_wifi_connected();
  */
 int request_get_wifi_rssi();
 
+/**
+ * Gets the stored mensa menu items and their count from the same fetch.
+ * A refresh can publish a different menu between two calls to the getters
+ * below, so code that indexes the items should use this one.
+ *
+ * @param count Receives the number of items (0 if none)
+ * @return Pointer to array of menu items
+ */
+const MensaMenuItem* request_get_menu(int* count);
+
 /**
  * Gets the stored mensa menu items.
  *
  * @return Pointer to array of menu items
  */
-MensaMenuItem* request_get_menu_items();
+const MensaMenuItem* request_get_menu_items();
 
 /**
  * Gets the number of stored menu items.
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Arduino.h>
+#include "text_font.h"
+
+// UTF-8 text on the SSD1306 framebuffer.
+//
+// Strings are decoded as UTF-8 and drawn with the 5x8 font in text_font.h
+// (ASCII, Latin-1 and the euro sign; typographic quotes and dashes fold to
+// their ASCII forms, anything else is a box). Glyphs go straight into the
+// page-format framebuffer in white, leaving other pixels alone like GFX
+// text without a background. Every glyph advances TEXT_ADVANCE columns, so
+// measuring a string is counting its code points.
+//
+// Drawn glyphs are kept in a small LRU cache already split into the two
+// page bytes per column for the row offset they were drawn at, so a
+// repeated letter on a line is a lookup and two ORs per column.
+
+#define TEXT_FRAMEBUFFER_WIDTH 128
+#define TEXT_FRAMEBUFFER_PAGES 8
+#define TEXT_ADVANCE 6
+#define TEXT_LINE_HEIGHT 8
+
+#ifndef TEXT_CACHE_SLOTS
+#define TEXT_CACHE_SLOTS 24
+#endif
+
+// Length argument meaning "up to the terminating NUL"
+#define TEXT_TO_END (static_cast<size_t>(-1))
+
+struct TextCacheStats {
+  uint32_t hits;
+  uint32_t misses;
+};
+
+/**
+ * Decodes the code point at *cursor and advances past it, stopping at
+ * `end`. Malformed or truncated sequences consume one byte and decode as
+ * U+FFFD.
+ */
+uint32_t text_decode(const char** cursor, const char* end);
+
+/**
+ * Pixel width of the first `length` bytes of `text`.
+ */
+int16_t text_width(const char* text, size_t length = TEXT_TO_END);
+
+/**
+ * Finds the first line of `text` that fits in `maxWidth` pixels, breaking
+ * after the last whole word (or inside a word too long for a line).
+ *
+ * @param next set to where the following line starts (spaces skipped)
+ * @return bytes of `text` on the line
+ */
+size_t text_wrap(const char* text, int16_t maxWidth, const char** next);
+
+/**
+ * Draws the first `length` bytes of `text` with its top-left corner at
+ * (x, y), clipped to the framebuffer.
+ *
+ * @return the x position after the last glyph
+ */
+int16_t text_draw(uint8_t* framebuffer, int16_t x, int16_t y, const char* text, size_t length = TEXT_TO_END);
+
+TextCacheStats text_get_cache_stats();
+
+/**
+ * Empties the glyph cache and clears its statistics.
+ */
+void text_reset_cache();
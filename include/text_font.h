@@ -0,0 +1,209 @@
+// Generated by generate_glyph_atlas.py from native/glcdfont.h - do not edit.
+#pragma once
+
+#include <Arduino.h>
+
+// 5x8 glyphs of the UTF-8 text engine, one byte per column (LSB at the top):
+// printable ASCII, Latin-1 (U+00A0-U+00FF) and the euro sign, then the
+// box drawn for anything else
+#define TEXT_FONT_COLUMNS 5
+#define TEXT_FONT_LATIN1_INDEX 95
+#define TEXT_FONT_EURO_INDEX 191
+#define TEXT_FONT_MISSING_INDEX 192
+#define TEXT_FONT_GLYPHS 193
+
+static const uint8_t TEXT_FONT[TEXT_FONT_GLYPHS * TEXT_FONT_COLUMNS] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00,  // U+0020 space (ascii)
+  0x00, 0x00, 0x5f, 0x00, 0x00,  // U+0021 exclamation mark (ascii)
+  0x00, 0x07, 0x00, 0x07, 0x00,  // U+0022 quotation mark (ascii)
+  0x14, 0x7f, 0x14, 0x7f, 0x14,  // U+0023 number sign (ascii)
+  0x24, 0x2a, 0x7f, 0x2a, 0x12,  // U+0024 dollar sign (ascii)
+  0x23, 0x13, 0x08, 0x64, 0x62,  // U+0025 percent sign (ascii)
+  0x36, 0x49, 0x56, 0x20, 0x50,  // U+0026 ampersand (ascii)
+  0x00, 0x08, 0x07, 0x03, 0x00,  // U+0027 apostrophe (ascii)
+  0x00, 0x1c, 0x22, 0x41, 0x00,  // U+0028 left parenthesis (ascii)
+  0x00, 0x41, 0x22, 0x1c, 0x00,  // U+0029 right parenthesis (ascii)
+  0x2a, 0x1c, 0x7f, 0x1c, 0x2a,  // U+002A asterisk (ascii)
+  0x08, 0x08, 0x3e, 0x08, 0x08,  // U+002B plus sign (ascii)
+  0x00, 0x80, 0x70, 0x30, 0x00,  // U+002C comma (ascii)
+  0x08, 0x08, 0x08, 0x08, 0x08,  // U+002D hyphen-minus (ascii)
+  0x00, 0x00, 0x60, 0x60, 0x00,  // U+002E full stop (ascii)
+  0x20, 0x10, 0x08, 0x04, 0x02,  // U+002F solidus (ascii)
+  0x3e, 0x51, 0x49, 0x45, 0x3e,  // U+0030 digit zero (ascii)
+  0x00, 0x42, 0x7f, 0x40, 0x00,  // U+0031 digit one (ascii)
+  0x72, 0x49, 0x49, 0x49, 0x46,  // U+0032 digit two (ascii)
+  0x21, 0x41, 0x49, 0x4d, 0x33,  // U+0033 digit three (ascii)
+  0x18, 0x14, 0x12, 0x7f, 0x10,  // U+0034 digit four (ascii)
+  0x27, 0x45, 0x45, 0x45, 0x39,  // U+0035 digit five (ascii)
+  0x3c, 0x4a, 0x49, 0x49, 0x31,  // U+0036 digit six (ascii)
+  0x41, 0x21, 0x11, 0x09, 0x07,  // U+0037 digit seven (ascii)
+  0x36, 0x49, 0x49, 0x49, 0x36,  // U+0038 digit eight (ascii)
+  0x46, 0x49, 0x49, 0x29, 0x1e,  // U+0039 digit nine (ascii)
+  0x00, 0x00, 0x14, 0x00, 0x00,  // U+003A colon (ascii)
+  0x00, 0x40, 0x34, 0x00, 0x00,  // U+003B semicolon (ascii)
+  0x00, 0x08, 0x14, 0x22, 0x41,  // U+003C less-than sign (ascii)
+  0x14, 0x14, 0x14, 0x14, 0x14,  // U+003D equals sign (ascii)
+  0x00, 0x41, 0x22, 0x14, 0x08,  // U+003E greater-than sign (ascii)
+  0x02, 0x01, 0x59, 0x09, 0x06,  // U+003F question mark (ascii)
+  0x3e, 0x41, 0x5d, 0x59, 0x4e,  // U+0040 commercial at (ascii)
+  0x7c, 0x12, 0x11, 0x12, 0x7c,  // U+0041 latin capital letter a (ascii)
+  0x7f, 0x49, 0x49, 0x49, 0x36,  // U+0042 latin capital letter b (ascii)
+  0x3e, 0x41, 0x41, 0x41, 0x22,  // U+0043 latin capital letter c (ascii)
+  0x7f, 0x41, 0x41, 0x41, 0x3e,  // U+0044 latin capital letter d (ascii)
+  0x7f, 0x49, 0x49, 0x49, 0x41,  // U+0045 latin capital letter e (ascii)
+  0x7f, 0x09, 0x09, 0x09, 0x01,  // U+0046 latin capital letter f (ascii)
+  0x3e, 0x41, 0x41, 0x51, 0x73,  // U+0047 latin capital letter g (ascii)
+  0x7f, 0x08, 0x08, 0x08, 0x7f,  // U+0048 latin capital letter h (ascii)
+  0x00, 0x41, 0x7f, 0x41, 0x00,  // U+0049 latin capital letter i (ascii)
+  0x20, 0x40, 0x41, 0x3f, 0x01,  // U+004A latin capital letter j (ascii)
+  0x7f, 0x08, 0x14, 0x22, 0x41,  // U+004B latin capital letter k (ascii)
+  0x7f, 0x40, 0x40, 0x40, 0x40,  // U+004C latin capital letter l (ascii)
+  0x7f, 0x02, 0x1c, 0x02, 0x7f,  // U+004D latin capital letter m (ascii)
+  0x7f, 0x04, 0x08, 0x10, 0x7f,  // U+004E latin capital letter n (ascii)
+  0x3e, 0x41, 0x41, 0x41, 0x3e,  // U+004F latin capital letter o (ascii)
+  0x7f, 0x09, 0x09, 0x09, 0x06,  // U+0050 latin capital letter p (ascii)
+  0x3e, 0x41, 0x51, 0x21, 0x5e,  // U+0051 latin capital letter q (ascii)
+  0x7f, 0x09, 0x19, 0x29, 0x46,  // U+0052 latin capital letter r (ascii)
+  0x26, 0x49, 0x49, 0x49, 0x32,  // U+0053 latin capital letter s (ascii)
+  0x03, 0x01, 0x7f, 0x01, 0x03,  // U+0054 latin capital letter t (ascii)
+  0x3f, 0x40, 0x40, 0x40, 0x3f,  // U+0055 latin capital letter u (ascii)
+  0x1f, 0x20, 0x40, 0x20, 0x1f,  // U+0056 latin capital letter v (ascii)
+  0x3f, 0x40, 0x38, 0x40, 0x3f,  // U+0057 latin capital letter w (ascii)
+  0x63, 0x14, 0x08, 0x14, 0x63,  // U+0058 latin capital letter x (ascii)
+  0x03, 0x04, 0x78, 0x04, 0x03,  // U+0059 latin capital letter y (ascii)
+  0x61, 0x59, 0x49, 0x4d, 0x43,  // U+005A latin capital letter z (ascii)
+  0x00, 0x7f, 0x41, 0x41, 0x41,  // U+005B left square bracket (ascii)
+  0x02, 0x04, 0x08, 0x10, 0x20,  // U+005C reverse solidus (ascii)
+  0x00, 0x41, 0x41, 0x41, 0x7f,  // U+005D right square bracket (ascii)
+  0x04, 0x02, 0x01, 0x02, 0x04,  // U+005E circumflex accent (ascii)
+  0x40, 0x40, 0x40, 0x40, 0x40,  // U+005F low line (ascii)
+  0x00, 0x03, 0x07, 0x08, 0x00,  // U+0060 grave accent (ascii)
+  0x20, 0x54, 0x54, 0x78, 0x40,  // U+0061 latin small letter a (ascii)
+  0x7f, 0x28, 0x44, 0x44, 0x38,  // U+0062 latin small letter b (ascii)
+  0x38, 0x44, 0x44, 0x44, 0x28,  // U+0063 latin small letter c (ascii)
+  0x38, 0x44, 0x44, 0x28, 0x7f,  // U+0064 latin small letter d (ascii)
+  0x38, 0x54, 0x54, 0x54, 0x18,  // U+0065 latin small letter e (ascii)
+  0x00, 0x08, 0x7e, 0x09, 0x02,  // U+0066 latin small letter f (ascii)
+  0x18, 0xa4, 0xa4, 0x9c, 0x78,  // U+0067 latin small letter g (ascii)
+  0x7f, 0x08, 0x04, 0x04, 0x78,  // U+0068 latin small letter h (ascii)
+  0x00, 0x44, 0x7d, 0x40, 0x00,  // U+0069 latin small letter i (ascii)
+  0x20, 0x40, 0x40, 0x3d, 0x00,  // U+006A latin small letter j (ascii)
+  0x7f, 0x10, 0x28, 0x44, 0x00,  // U+006B latin small letter k (ascii)
+  0x00, 0x41, 0x7f, 0x40, 0x00,  // U+006C latin small letter l (ascii)
+  0x7c, 0x04, 0x78, 0x04, 0x78,  // U+006D latin small letter m (ascii)
+  0x7c, 0x08, 0x04, 0x04, 0x78,  // U+006E latin small letter n (ascii)
+  0x38, 0x44, 0x44, 0x44, 0x38,  // U+006F latin small letter o (ascii)
+  0xfc, 0x18, 0x24, 0x24, 0x18,  // U+0070 latin small letter p (ascii)
+  0x18, 0x24, 0x24, 0x18, 0xfc,  // U+0071 latin small letter q (ascii)
+  0x7c, 0x08, 0x04, 0x04, 0x08,  // U+0072 latin small letter r (ascii)
+  0x48, 0x54, 0x54, 0x54, 0x24,  // U+0073 latin small letter s (ascii)
+  0x04, 0x04, 0x3f, 0x44, 0x24,  // U+0074 latin small letter t (ascii)
+  0x3c, 0x40, 0x40, 0x20, 0x7c,  // U+0075 latin small letter u (ascii)
+  0x1c, 0x20, 0x40, 0x20, 0x1c,  // U+0076 latin small letter v (ascii)
+  0x3c, 0x40, 0x30, 0x40, 0x3c,  // U+0077 latin small letter w (ascii)
+  0x44, 0x28, 0x10, 0x28, 0x44,  // U+0078 latin small letter x (ascii)
+  0x4c, 0x90, 0x90, 0x90, 0x7c,  // U+0079 latin small letter y (ascii)
+  0x44, 0x64, 0x54, 0x4c, 0x44,  // U+007A latin small letter z (ascii)
+  0x00, 0x08, 0x36, 0x41, 0x00,  // U+007B left curly bracket (ascii)
+  0x00, 0x00, 0x77, 0x00, 0x00,  // U+007C vertical line (ascii)
+  0x00, 0x41, 0x36, 0x08, 0x00,  // U+007D right curly bracket (ascii)
+  0x02, 0x01, 0x02, 0x04, 0x02,  // U+007E tilde (ascii)
+  0x00, 0x00, 0x00, 0x00, 0x00,  // U+00A0 no-break space (drawn)
+  0x00, 0x00, 0x7d, 0x00, 0x00,  // U+00A1 inverted exclamation mark (drawn)
+  0x1c, 0x22, 0x7f, 0x22, 0x22,  // U+00A2 cent sign (drawn)
+  0x48, 0x3e, 0x49, 0x41, 0x22,  // U+00A3 pound sign (drawn)
+  0x7f, 0x41, 0x41, 0x41, 0x7f,  // U+00A4 currency sign (missing)
+  0x15, 0x16, 0x7c, 0x16, 0x15,  // U+00A5 yen sign (drawn)
+  0x00, 0x00, 0x77, 0x00, 0x00,  // U+00A6 broken bar (drawn)
+  0x4a, 0x55, 0x55, 0x29, 0x00,  // U+00A7 section sign (drawn)
+  0x00, 0x01, 0x00, 0x01, 0x00,  // U+00A8 diaeresis (drawn)
+  0x7f, 0x41, 0x41, 0x41, 0x7f,  // U+00A9 copyright sign (missing)
+  0x12, 0x15, 0x17, 0x00, 0x00,  // U+00AA feminine ordinal indicator (drawn)
+  0x08, 0x14, 0x2a, 0x14, 0x22,  // U+00AB left-pointing double angle quotation mark (drawn)
+  0x08, 0x08, 0x08, 0x08, 0x18,  // U+00AC not sign (drawn)
+  0x08, 0x08, 0x08, 0x08, 0x08,  // U+00AD soft hyphen (drawn)
+  0x7f, 0x41, 0x41, 0x41, 0x7f,  // U+00AE registered sign (missing)
+  0x01, 0x01, 0x01, 0x01, 0x01,  // U+00AF macron (drawn)
+  0x06, 0x09, 0x09, 0x06, 0x00,  // U+00B0 degree sign (drawn)
+  0x44, 0x44, 0x5f, 0x44, 0x44,  // U+00B1 plus-minus sign (drawn)
+  0x00, 0x09, 0x0d, 0x0a, 0x00,  // U+00B2 superscript two (drawn)
+  0x00, 0x09, 0x0b, 0x05, 0x00,  // U+00B3 superscript three (drawn)
+  0x00, 0x00, 0x02, 0x01, 0x00,  // U+00B4 acute accent (drawn)
+  0xfc, 0x20, 0x40, 0x60, 0x3c,  // U+00B5 micro sign (drawn)
+  0x7f, 0x41, 0x41, 0x41, 0x7f,  // U+00B6 pilcrow sign (missing)
+  0x00, 0x00, 0x08, 0x00, 0x00,  // U+00B7 middle dot (drawn)
+  0x00, 0x80, 0xc0, 0x00, 0x00,  // U+00B8 cedilla (drawn)
+  0x00, 0x0a, 0x0f, 0x08, 0x00,  // U+00B9 superscript one (drawn)
+  0x12, 0x15, 0x12, 0x00, 0x00,  // U+00BA masculine ordinal indicator (drawn)
+  0x22, 0x14, 0x2a, 0x14, 0x08,  // U+00BB right-pointing double angle quotation mark (drawn)
+  0x7f, 0x41, 0x41, 0x41, 0x7f,  // U+00BC vulgar fraction one quarter (missing)
+  0x7f, 0x41, 0x41, 0x41, 0x7f,  // U+00BD vulgar fraction one half (missing)
+  0x7f, 0x41, 0x41, 0x41, 0x7f,  // U+00BE vulgar fraction three quarters (missing)
+  0x30, 0x48, 0x4d, 0x40, 0x20,  // U+00BF inverted question mark (drawn)
+  0xf8, 0x25, 0x22, 0x24, 0xf8,  // U+00C0 latin capital letter a with grave (composed)
+  0xf8, 0x24, 0x22, 0x25, 0xf8,  // U+00C1 latin capital letter a with acute (composed)
+  0xf8, 0x25, 0x23, 0x25, 0xf8,  // U+00C2 latin capital letter a with circumflex (composed)
+  0xf9, 0x25, 0x22, 0x25, 0xf9,  // U+00C3 latin capital letter a with tilde (composed)
+  0xf8, 0x25, 0x22, 0x25, 0xf8,  // U+00C4 latin capital letter a with diaeresis (composed)
+  0xf8, 0x24, 0x23, 0x24, 0xf8,  // U+00C5 latin capital letter a with ring above (composed)
+  0x7e, 0x09, 0x7f, 0x49, 0x49,  // U+00C6 latin capital letter ae (drawn)
+  0x3e, 0x41, 0xc1, 0x41, 0x22,  // U+00C7 latin capital letter c with cedilla (composed)
+  0xfe, 0x93, 0x92, 0x92, 0x82,  // U+00C8 latin capital letter e with grave (composed)
+  0xfe, 0x92, 0x92, 0x93, 0x82,  // U+00C9 latin capital letter e with acute (composed)
+  0xfe, 0x93, 0x93, 0x93, 0x82,  // U+00CA latin capital letter e with circumflex (composed)
+  0xfe, 0x93, 0x92, 0x93, 0x82,  // U+00CB latin capital letter e with diaeresis (composed)
+  0x00, 0x83, 0xfe, 0x82, 0x00,  // U+00CC latin capital letter i with grave (composed)
+  0x00, 0x82, 0xfe, 0x83, 0x00,  // U+00CD latin capital letter i with acute (composed)
+  0x00, 0x83, 0xff, 0x83, 0x00,  // U+00CE latin capital letter i with circumflex (composed)
+  0x00, 0x83, 0xfe, 0x83, 0x00,  // U+00CF latin capital letter i with diaeresis (composed)
+  0x08, 0x7f, 0x49, 0x41, 0x3e,  // U+00D0 latin capital letter eth (drawn)
+  0xff, 0x09, 0x10, 0x21, 0xff,  // U+00D1 latin capital letter n with tilde (composed)
+  0x7c, 0x83, 0x82, 0x82, 0x7c,  // U+00D2 latin capital letter o with grave (composed)
+  0x7c, 0x82, 0x82, 0x83, 0x7c,  // U+00D3 latin capital letter o with acute (composed)
+  0x7c, 0x83, 0x83, 0x83, 0x7c,  // U+00D4 latin capital letter o with circumflex (composed)
+  0x7d, 0x83, 0x82, 0x83, 0x7d,  // U+00D5 latin capital letter o with tilde (composed)
+  0x7c, 0x83, 0x82, 0x83, 0x7c,  // U+00D6 latin capital letter o with diaeresis (composed)
+  0x22, 0x14, 0x08, 0x14, 0x22,  // U+00D7 multiplication sign (drawn)
+  0x3e, 0x61, 0x5d, 0x43, 0x3e,  // U+00D8 latin capital letter o with stroke (drawn)
+  0x7e, 0x81, 0x80, 0x80, 0x7e,  // U+00D9 latin capital letter u with grave (composed)
+  0x7e, 0x80, 0x80, 0x81, 0x7e,  // U+00DA latin capital letter u with acute (composed)
+  0x7e, 0x81, 0x81, 0x81, 0x7e,  // U+00DB latin capital letter u with circumflex (composed)
+  0x7e, 0x81, 0x80, 0x81, 0x7e,  // U+00DC latin capital letter u with diaeresis (composed)
+  0x06, 0x08, 0xf0, 0x09, 0x06,  // U+00DD latin capital letter y with acute (composed)
+  0x7f, 0x12, 0x12, 0x12, 0x0c,  // U+00DE latin capital letter thorn (drawn)
+  0xfe, 0x01, 0x49, 0x76, 0x00,  // U+00DF latin small letter sharp s (drawn)
+  0x20, 0x55, 0x55, 0x78, 0x40,  // U+00E0 latin small letter a with grave (composed)
+  0x20, 0x54, 0x54, 0x79, 0x41,  // U+00E1 latin small letter a with acute (composed)
+  0x20, 0x56, 0x55, 0x7a, 0x40,  // U+00E2 latin small letter a with circumflex (composed)
+  0x22, 0x55, 0x56, 0x79, 0x40,  // U+00E3 latin small letter a with tilde (composed)
+  0x20, 0x55, 0x54, 0x79, 0x40,  // U+00E4 latin small letter a with diaeresis (composed)
+  0x20, 0x54, 0x55, 0x78, 0x40,  // U+00E5 latin small letter a with ring above (composed)
+  0x24, 0x54, 0x38, 0x54, 0x58,  // U+00E6 latin small letter ae (drawn)
+  0x38, 0x44, 0xc4, 0x44, 0x28,  // U+00E7 latin small letter c with cedilla (composed)
+  0x38, 0x55, 0x55, 0x54, 0x18,  // U+00E8 latin small letter e with grave (composed)
+  0x38, 0x54, 0x54, 0x55, 0x19,  // U+00E9 latin small letter e with acute (composed)
+  0x38, 0x56, 0x55, 0x56, 0x18,  // U+00EA latin small letter e with circumflex (composed)
+  0x38, 0x55, 0x54, 0x55, 0x18,  // U+00EB latin small letter e with diaeresis (composed)
+  0x00, 0x45, 0x7d, 0x40, 0x00,  // U+00EC latin small letter i with grave (composed)
+  0x00, 0x44, 0x7c, 0x41, 0x01,  // U+00ED latin small letter i with acute (composed)
+  0x00, 0x46, 0x7d, 0x42, 0x00,  // U+00EE latin small letter i with circumflex (composed)
+  0x00, 0x45, 0x7c, 0x41, 0x00,  // U+00EF latin small letter i with diaeresis (composed)
+  0x20, 0x55, 0x52, 0x5d, 0x30,  // U+00F0 latin small letter eth (drawn)
+  0x7e, 0x09, 0x06, 0x05, 0x78,  // U+00F1 latin small letter n with tilde (composed)
+  0x38, 0x45, 0x45, 0x44, 0x38,  // U+00F2 latin small letter o with grave (composed)
+  0x38, 0x44, 0x44, 0x45, 0x39,  // U+00F3 latin small letter o with acute (composed)
+  0x38, 0x46, 0x45, 0x46, 0x38,  // U+00F4 latin small letter o with circumflex (composed)
+  0x3a, 0x45, 0x46, 0x45, 0x38,  // U+00F5 latin small letter o with tilde (composed)
+  0x38, 0x45, 0x44, 0x45, 0x38,  // U+00F6 latin small letter o with diaeresis (composed)
+  0x08, 0x08, 0x2a, 0x08, 0x08,  // U+00F7 division sign (drawn)
+  0x38, 0x64, 0x54, 0x4c, 0x38,  // U+00F8 latin small letter o with stroke (drawn)
+  0x3c, 0x41, 0x41, 0x20, 0x7c,  // U+00F9 latin small letter u with grave (composed)
+  0x3c, 0x40, 0x40, 0x21, 0x7d,  // U+00FA latin small letter u with acute (composed)
+  0x3c, 0x42, 0x41, 0x22, 0x7c,  // U+00FB latin small letter u with circumflex (composed)
+  0x3c, 0x41, 0x40, 0x21, 0x7c,  // U+00FC latin small letter u with diaeresis (composed)
+  0x4c, 0x90, 0x90, 0x91, 0x7d,  // U+00FD latin small letter y with acute (composed)
+  0xfe, 0x24, 0x24, 0x18, 0x00,  // U+00FE latin small letter thorn (drawn)
+  0x4c, 0x91, 0x90, 0x91, 0x7c,  // U+00FF latin small letter y with diaeresis (composed)
+  0x14, 0x3e, 0x55, 0x55, 0x41,  // U+20AC euro sign (drawn)
+  0x7f, 0x41, 0x41, 0x41, 0x7f,  // missing glyph
+};
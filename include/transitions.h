@@ -0,0 +1,170 @@
+#pragma once
+
+#include <Arduino.h>
+#include "pomodoro.h"
+
+// Button dispatch table.
+//
+// What a button does depends on the application mode, the pomodoro state
+// and the input. input_rule() spells that out once, as one constexpr
+// expression per mode. The compiler expands it into a flat table covering
+// every (AppMode, PomodoroState, InputEvent) combination, so dispatching
+// an input is a single array lookup. The static_asserts below fail the
+// build if any combination has no rule.
+//
+// Written in C++11 constexpr (single-return functions, no loops) because
+// the ESP32 toolchain builds with -std=gnu++11.
+
+enum class AppMode : uint8_t {
+  NORMAL,
+  SETTINGS,
+  MENSA_MENU,
+  GAMBLING,
+  COUNT
+};
+
+enum class InputEvent : uint8_t {
+  BUTTON1_PRESS,          // press or double click of button 1
+  BUTTON2_PRESS,
+  BUTTON2_DOUBLE_CLICK,
+  BOTH_PRESSED,           // chord: the second button went down while the first was held
+  BUTTON2_CLICK_TIMEOUT,  // a held-back button 2 click is past the double-click window
+  COUNT
+};
+
+enum class InputAction : uint8_t {
+  UNDEFINED,              // no rule matched; never present in the table
+  NONE,
+  SETTINGS_DECREASE,
+  SETTINGS_INCREASE,
+  SETTINGS_CONFIRM,
+  GAMBLE_RED,
+  GAMBLE_BLACK,
+  MENU_PREVIOUS,
+  MENU_NEXT,
+  EXIT_SPECIAL_MODE,
+  START_SESSION,
+  PAUSE_SESSION,
+  RESUME_SESSION,
+  RESET_SESSION,
+  BUTTON2_CLICK,          // hold the click back in case a second one follows
+  BUTTON2_DOUBLE_CLICK,   // enter settings if a click is being held back
+  TOGGLE_MODE,
+  ENTER_SETTINGS,
+  COUNT
+};
+
+const int APP_MODE_COUNT = static_cast<int>(AppMode::COUNT);
+const int POMODORO_STATE_COUNT = POMODORO_PAUSED + 1;
+const int INPUT_EVENT_COUNT = static_cast<int>(InputEvent::COUNT);
+const int INPUT_TABLE_SIZE = APP_MODE_COUNT * POMODORO_STATE_COUNT * INPUT_EVENT_COUNT;
+
+constexpr bool input_is_session_running(PomodoroState state) {
+  return state == POMODORO_WORK || state == POMODORO_SHORT_BREAK ||
+         state == POMODORO_LONG_BREAK;
+}
+
+// Timer screens: start, pause/resume, reset, and the settings gestures
+// while idle
+constexpr InputAction input_rule_normal(PomodoroState state, InputEvent event) {
+  return event == InputEvent::BUTTON1_PRESS ?
+           (state == POMODORO_IDLE ? InputAction::START_SESSION :
+            state == POMODORO_PAUSED ? InputAction::RESUME_SESSION :
+            input_is_session_running(state) ? InputAction::PAUSE_SESSION :
+            InputAction::UNDEFINED) :
+         event == InputEvent::BUTTON2_PRESS ?
+           (state == POMODORO_IDLE ? InputAction::BUTTON2_CLICK : InputAction::RESET_SESSION) :
+         event == InputEvent::BUTTON2_DOUBLE_CLICK ?
+           (state == POMODORO_IDLE ? InputAction::BUTTON2_DOUBLE_CLICK : InputAction::RESET_SESSION) :
+         event == InputEvent::BOTH_PRESSED ?
+           (state == POMODORO_IDLE ? InputAction::ENTER_SETTINGS : InputAction::NONE) :
+         event == InputEvent::BUTTON2_CLICK_TIMEOUT ?
+           (state == POMODORO_IDLE ? InputAction::TOGGLE_MODE : InputAction::NONE) :
+         InputAction::UNDEFINED;
+}
+
+// Settings, menu and gambling screens behave the same in every pomodoro
+// state: button 1 goes down/left, button 2 up/right, both leave
+constexpr InputAction input_rule_overlay(InputAction button1, InputAction button2,
+                                         InputAction both, InputEvent event) {
+  return event == InputEvent::BUTTON1_PRESS ? button1 :
+         event == InputEvent::BUTTON2_PRESS ? button2 :
+         event == InputEvent::BUTTON2_DOUBLE_CLICK ? button2 :
+         event == InputEvent::BOTH_PRESSED ? both :
+         event == InputEvent::BUTTON2_CLICK_TIMEOUT ? InputAction::NONE :
+         InputAction::UNDEFINED;
+}
+
+constexpr InputAction input_rule(AppMode mode, PomodoroState state, InputEvent event) {
+  return mode == AppMode::NORMAL ? input_rule_normal(state, event) :
+         mode == AppMode::SETTINGS ?
+           input_rule_overlay(InputAction::SETTINGS_DECREASE, InputAction::SETTINGS_INCREASE,
+                              InputAction::SETTINGS_CONFIRM, event) :
+         mode == AppMode::MENSA_MENU ?
+           input_rule_overlay(InputAction::MENU_PREVIOUS, InputAction::MENU_NEXT,
+                              InputAction::EXIT_SPECIAL_MODE, event) :
+         mode == AppMode::GAMBLING ?
+           input_rule_overlay(InputAction::GAMBLE_RED, InputAction::GAMBLE_BLACK,
+                              InputAction::EXIT_SPECIAL_MODE, event) :
+         InputAction::UNDEFINED;
+}
+
+// Table index of a combination, and the rule for an index
+constexpr int input_table_index(AppMode mode, PomodoroState state, InputEvent event) {
+  return (static_cast<int>(mode) * POMODORO_STATE_COUNT + static_cast<int>(state)) *
+             INPUT_EVENT_COUNT + static_cast<int>(event);
+}
+
+constexpr InputAction input_rule_at(int index) {
+  return input_rule(static_cast<AppMode>(index / (POMODORO_STATE_COUNT * INPUT_EVENT_COUNT)),
+                    static_cast<PomodoroState>((index / INPUT_EVENT_COUNT) % POMODORO_STATE_COUNT),
+                    static_cast<InputEvent>(index % INPUT_EVENT_COUNT));
+}
+
+// Expand input_rule_at(0 .. N-1) into an array at compile time
+template <int... I>
+struct InputIndexList {};
+
+template <int N, int... I>
+struct MakeInputIndexList : MakeInputIndexList<N - 1, N - 1, I...> {};
+
+template <int... I>
+struct MakeInputIndexList<0, I...> {
+  typedef InputIndexList<I...> type;
+};
+
+template <typename List>
+struct InputTable;
+
+template <int... I>
+struct InputTable<InputIndexList<I...> > {
+  static constexpr InputAction actions[sizeof...(I)] = {input_rule_at(I)...};
+};
+
+template <int... I>
+constexpr InputAction InputTable<InputIndexList<I...> >::actions[sizeof...(I)];
+
+typedef InputTable<MakeInputIndexList<INPUT_TABLE_SIZE>::type> InputTransitions;
+
+// Compile-time proof that every combination has a rule
+constexpr bool input_rules_complete(int index) {
+  return index >= INPUT_TABLE_SIZE ||
+         (input_rule_at(index) != InputAction::UNDEFINED && input_rules_complete(index + 1));
+}
+
+static_assert(input_rules_complete(0), "a (mode, state, input) combination has no rule");
+static_assert(sizeof(InputTransitions::actions) == INPUT_TABLE_SIZE * sizeof(InputAction),
+              "input table does not cover the state space");
+static_assert(input_rule(AppMode::NORMAL, POMODORO_IDLE, InputEvent::BUTTON1_PRESS) ==
+                  InputAction::START_SESSION,
+              "button 1 starts a session from idle");
+static_assert(input_rule(AppMode::SETTINGS, POMODORO_IDLE, InputEvent::BOTH_PRESSED) ==
+                  InputAction::SETTINGS_CONFIRM,
+              "both buttons confirm settings");
+
+/**
+ * Action for an input in the given mode and pomodoro state (one lookup).
+ */
+inline InputAction input_action(AppMode mode, PomodoroState state, InputEvent event) {
+  return InputTransitions::actions[input_table_index(mode, state, event)];
+}
@@ -10,12 +10,21 @@
 // Initialize ultrasound sensor
 void ultrasound_init();
 
-// Measure and save the initial distance
+// Finish the measurement in flight once its echo arrived or timed out (call every loop)
+void ultrasound_update();
+
+// Start measuring the initial distance; stored by ultrasound_update() when done
 void ultrasound_measure_initial_distance();
 
-// Take a single measurement and store it (for continuous monitoring)
+// Start a single measurement (for continuous monitoring); returns immediately
 void ultrasound_take_single_measurement();
 
+// True once per single measurement finished by ultrasound_update()
+bool ultrasound_measurement_ready();
+
+// True while a ping is waiting for its echo
+bool ultrasound_is_busy();
+
 // Store a measurement at a specific index (0, 1, or 2)
 void ultrasound_store_measurement(int index, float measurement);
 
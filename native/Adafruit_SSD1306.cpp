@@ -0,0 +1,315 @@
+#include "Adafruit_SSD1306.h"
+#include "native_hal.h"
+
+#define WIRE_MAX I2C_BUFFER_LENGTH
+
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi, int8_t rst_pin,
+                                   uint32_t clkDuring, uint32_t clkAfter)
+    : Adafruit_GFX(w, h), wire(twi ? twi : &Wire), buffer(nullptr), i2caddr(0),
+      vccstate(SSD1306_SWITCHCAPVCC), wireClk(clkDuring), restoreClk(clkAfter) {
+  (void)rst_pin;
+}
+
+Adafruit_SSD1306::~Adafruit_SSD1306() {
+  free(buffer);
+}
+
+void Adafruit_SSD1306::ssd1306_command1(uint8_t c) {
+  wire->beginTransmission(i2caddr);
+  wire->write(static_cast<uint8_t>(0x00));
+  wire->write(c);
+  wire->endTransmission();
+}
+
+void Adafruit_SSD1306::ssd1306_commandList(const uint8_t* c, uint8_t n) {
+  wire->beginTransmission(i2caddr);
+  wire->write(static_cast<uint8_t>(0x00));
+  uint16_t bytesOut = 1;
+  while (n--) {
+    if (bytesOut >= WIRE_MAX) {
+      wire->endTransmission();
+      wire->beginTransmission(i2caddr);
+      wire->write(static_cast<uint8_t>(0x00));
+      bytesOut = 1;
+    }
+    wire->write(*c++);
+    bytesOut++;
+  }
+  wire->endTransmission();
+}
+
+void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
+  wire->setClock(wireClk);
+  ssd1306_command1(c);
+  wire->setClock(restoreClk);
+}
+
+bool Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, bool reset, bool periphBegin) {
+  (void)reset;
+  if (!buffer && !(buffer = static_cast<uint8_t*>(malloc(WIDTH * ((HEIGHT + 7) / 8))))) {
+    return false;
+  }
+  clearDisplay();
+
+  vccstate = vcs;
+  i2caddr = addr ? addr : ((HEIGHT == 32) ? 0x3C : 0x3D);
+  if (periphBegin) {
+    wire->begin();
+  }
+
+  wire->setClock(wireClk);
+  static const uint8_t init1[] = {SSD1306_DISPLAYOFF, SSD1306_SETDISPLAYCLOCKDIV, 0x80, SSD1306_SETMULTIPLEX};
+  ssd1306_commandList(init1, sizeof(init1));
+  ssd1306_command1(HEIGHT - 1);
+
+  static const uint8_t init2[] = {SSD1306_SETDISPLAYOFFSET, 0x0, SSD1306_SETSTARTLINE | 0x0, SSD1306_CHARGEPUMP};
+  ssd1306_commandList(init2, sizeof(init2));
+  ssd1306_command1((vccstate == SSD1306_EXTERNALVCC) ? 0x10 : 0x14);
+
+  static const uint8_t init3[] = {SSD1306_MEMORYMODE, 0x00, SSD1306_SEGREMAP | 0x1, SSD1306_COMSCANDEC};
+  ssd1306_commandList(init3, sizeof(init3));
+
+  static const uint8_t init4b[] = {SSD1306_SETCOMPINS, 0x12, SSD1306_SETCONTRAST};
+  ssd1306_commandList(init4b, sizeof(init4b));
+  ssd1306_command1((vccstate == SSD1306_EXTERNALVCC) ? 0x9F : 0xCF);
+
+  ssd1306_command1(SSD1306_SETPRECHARGE);
+  ssd1306_command1((vccstate == SSD1306_EXTERNALVCC) ? 0x22 : 0xF1);
+  static const uint8_t init5[] = {SSD1306_SETVCOMDETECT, 0x40, SSD1306_DISPLAYALLON_RESUME,
+                                  SSD1306_NORMALDISPLAY, SSD1306_DEACTIVATE_SCROLL, SSD1306_DISPLAYON};
+  ssd1306_commandList(init5, sizeof(init5));
+  wire->setClock(restoreClk);
+  return true;
+}
+
+void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) {
+    return;
+  }
+  native_hal_pixel_account(1);
+  uint8_t& cell = buffer[x + (y / 8) * WIDTH];
+  uint8_t bit = static_cast<uint8_t>(1 << (y & 7));
+  switch (color) {
+    case SSD1306_WHITE: cell |= bit; break;
+    case SSD1306_BLACK: cell &= static_cast<uint8_t>(~bit); break;
+    case SSD1306_INVERSE: cell ^= bit; break;
+  }
+}
+
+void Adafruit_SSD1306::clearDisplay() {
+  memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+  native_hal_pixel_account(WIDTH * HEIGHT);
+}
+
+void Adafruit_SSD1306::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  drawFastHLineInternal(x, y, w, color);
+}
+
+void Adafruit_SSD1306::drawFastHLineInternal(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if ((y < 0) || (y >= HEIGHT)) {
+    return;
+  }
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if ((x + w) > WIDTH) {
+    w = WIDTH - x;
+  }
+  if (w <= 0) {
+    return;
+  }
+  native_hal_pixel_account(static_cast<uint32_t>(w));
+
+  uint8_t* pBuf = &buffer[(y / 8) * WIDTH + x];
+  uint8_t mask = static_cast<uint8_t>(1 << (y & 7));
+  switch (color) {
+    case SSD1306_WHITE: while (w--) { *pBuf++ |= mask; } break;
+    case SSD1306_BLACK: mask = ~mask; while (w--) { *pBuf++ &= mask; } break;
+    case SSD1306_INVERSE: while (w--) { *pBuf++ ^= mask; } break;
+  }
+}
+
+void Adafruit_SSD1306::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  drawFastVLineInternal(x, y, h, color);
+}
+
+void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y, int16_t __h, uint16_t color) {
+  if ((x < 0) || (x >= WIDTH)) {
+    return;
+  }
+  if (__y < 0) {
+    __h += __y;
+    __y = 0;
+  }
+  if ((__y + __h) > HEIGHT) {
+    __h = HEIGHT - __y;
+  }
+  if (__h <= 0) {
+    return;
+  }
+  native_hal_pixel_account(static_cast<uint32_t>(__h));
+
+  uint8_t y = static_cast<uint8_t>(__y);
+  uint8_t h = static_cast<uint8_t>(__h);
+  uint8_t* pBuf = &buffer[(y / 8) * WIDTH + x];
+
+  // Partial first page
+  uint8_t mod = (y & 7);
+  if (mod) {
+    mod = 8 - mod;
+    static const uint8_t premask[8] = {0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE};
+    uint8_t mask = premask[mod];
+    if (h < mod) {
+      mask &= (0xFF >> (mod - h));
+    }
+    switch (color) {
+      case SSD1306_WHITE: *pBuf |= mask; break;
+      case SSD1306_BLACK: *pBuf &= ~mask; break;
+      case SSD1306_INVERSE: *pBuf ^= mask; break;
+    }
+    pBuf += WIDTH;
+  }
+
+  if (h >= mod) {
+    h -= mod;
+    // Whole pages
+    if (h >= 8) {
+      if (color == SSD1306_INVERSE) {
+        do {
+          *pBuf ^= 0xFF;
+          pBuf += WIDTH;
+          h -= 8;
+        } while (h >= 8);
+      } else {
+        uint8_t val = (color != SSD1306_BLACK) ? 255 : 0;
+        do {
+          *pBuf = val;
+          pBuf += WIDTH;
+          h -= 8;
+        } while (h >= 8);
+      }
+    }
+
+    // Partial last page
+    if (h) {
+      mod = h & 7;
+      static const uint8_t postmask[8] = {0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F};
+      uint8_t mask = postmask[mod];
+      switch (color) {
+        case SSD1306_WHITE: *pBuf |= mask; break;
+        case SSD1306_BLACK: *pBuf &= ~mask; break;
+        case SSD1306_INVERSE: *pBuf ^= mask; break;
+      }
+    }
+  }
+}
+
+bool Adafruit_SSD1306::getPixel(int16_t x, int16_t y) {
+  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) {
+    return false;
+  }
+  return (buffer[x + (y / 8) * WIDTH] & (1 << (y & 7)));
+}
+
+uint8_t* Adafruit_SSD1306::getBuffer() {
+  return buffer;
+}
+
+void Adafruit_SSD1306::display() {
+  wire->setClock(wireClk);
+  static const uint8_t dlist1[] = {SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0};
+  ssd1306_commandList(dlist1, sizeof(dlist1));
+  ssd1306_command1(WIDTH - 1);
+
+  uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
+  uint8_t* ptr = buffer;
+  wire->beginTransmission(i2caddr);
+  wire->write(static_cast<uint8_t>(0x40));
+  uint16_t bytesOut = 1;
+  while (count--) {
+    if (bytesOut >= WIRE_MAX) {
+      wire->endTransmission();
+      wire->beginTransmission(i2caddr);
+      wire->write(static_cast<uint8_t>(0x40));
+      bytesOut = 1;
+    }
+    wire->write(*ptr++);
+    bytesOut++;
+  }
+  wire->endTransmission();
+  wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop) {
+  wire->setClock(wireClk);
+  static const uint8_t scrollList1a[] = {SSD1306_RIGHT_HORIZONTAL_SCROLL, 0x00};
+  ssd1306_commandList(scrollList1a, sizeof(scrollList1a));
+  ssd1306_command1(start);
+  ssd1306_command1(0x00);
+  ssd1306_command1(stop);
+  static const uint8_t scrollList1b[] = {0x00, 0xFF, SSD1306_ACTIVATE_SCROLL};
+  ssd1306_commandList(scrollList1b, sizeof(scrollList1b));
+  wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop) {
+  wire->setClock(wireClk);
+  static const uint8_t scrollList2a[] = {SSD1306_LEFT_HORIZONTAL_SCROLL, 0x00};
+  ssd1306_commandList(scrollList2a, sizeof(scrollList2a));
+  ssd1306_command1(start);
+  ssd1306_command1(0x00);
+  ssd1306_command1(stop);
+  static const uint8_t scrollList2b[] = {0x00, 0xFF, SSD1306_ACTIVATE_SCROLL};
+  ssd1306_commandList(scrollList2b, sizeof(scrollList2b));
+  wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop) {
+  wire->setClock(wireClk);
+  static const uint8_t scrollList3a[] = {SSD1306_SET_VERTICAL_SCROLL_AREA, 0x00};
+  ssd1306_commandList(scrollList3a, sizeof(scrollList3a));
+  ssd1306_command1(HEIGHT);
+  static const uint8_t scrollList3b[] = {SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL, 0x00};
+  ssd1306_commandList(scrollList3b, sizeof(scrollList3b));
+  ssd1306_command1(start);
+  ssd1306_command1(0x00);
+  ssd1306_command1(stop);
+  static const uint8_t scrollList3c[] = {0x01, SSD1306_ACTIVATE_SCROLL};
+  ssd1306_commandList(scrollList3c, sizeof(scrollList3c));
+  wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::startscrolldiagleft(uint8_t start, uint8_t stop) {
+  wire->setClock(wireClk);
+  static const uint8_t scrollList4a[] = {SSD1306_SET_VERTICAL_SCROLL_AREA, 0x00};
+  ssd1306_commandList(scrollList4a, sizeof(scrollList4a));
+  ssd1306_command1(HEIGHT);
+  static const uint8_t scrollList4b[] = {SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL, 0x00};
+  ssd1306_commandList(scrollList4b, sizeof(scrollList4b));
+  ssd1306_command1(start);
+  ssd1306_command1(0x00);
+  ssd1306_command1(stop);
+  static const uint8_t scrollList4c[] = {0x01, SSD1306_ACTIVATE_SCROLL};
+  ssd1306_commandList(scrollList4c, sizeof(scrollList4c));
+  wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::stopscroll() {
+  wire->setClock(wireClk);
+  ssd1306_command1(SSD1306_DEACTIVATE_SCROLL);
+  wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::invertDisplay(bool i) {
+  wire->setClock(wireClk);
+  ssd1306_command1(i ? SSD1306_INVERTDISPLAY : SSD1306_NORMALDISPLAY);
+  wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::dim(bool dim) {
+  wire->setClock(wireClk);
+  ssd1306_command1(SSD1306_SETCONTRAST);
+  ssd1306_command1(dim ? 0 : (vccstate == SSD1306_EXTERNALVCC) ? 0x9F : 0xCF);
+  wire->setClock(restoreClk);
+}
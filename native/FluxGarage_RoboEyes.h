@@ -0,0 +1,157 @@
+#pragma once
+
+// Stand-in for FluxGarage RoboEyes with the same public surface and the same
+// per-frame work: tween eye geometry, clear, fill the eyes and eyelids, and
+// push the frame with display().
+
+#include <Arduino.h>
+
+#define BGCOLOR 0
+#define MAINCOLOR 1
+
+#define DEFAULT 0
+#define TIRED 1
+#define ANGRY 2
+#define HAPPY 3
+
+#define ON 1
+#define OFF 0
+
+#define N 1
+#define NE 2
+#define E 3
+#define SE 4
+#define S 5
+#define SW 6
+#define W 7
+#define NW 8
+
+template <typename AdafruitDisplay>
+class RoboEyes {
+public:
+  explicit RoboEyes(AdafruitDisplay& disp) : display(&disp) {}
+
+  void begin(int width, int height, byte frameRate) {
+    screenWidth = width;
+    screenHeight = height;
+    setFramerate(frameRate);
+    display->clearDisplay();
+    display->display();
+    eyeHeightCurrent = 1;
+    eyeXNext = eyeXDefault();
+    eyeYNext = eyeYDefault();
+  }
+
+  void update() {
+    if (millis() - fpsTimer >= frameInterval) {
+      drawEyes();
+      fpsTimer = millis();
+    }
+  }
+
+  void setFramerate(byte fps) { frameInterval = 1000 / (fps ? fps : 1); }
+  void setMood(unsigned char mood) {
+    tired = (mood == TIRED);
+    angry = (mood == ANGRY);
+    happy = (mood == HAPPY);
+  }
+  void setCuriosity(bool curiousBit) { curious = curiousBit; }
+  void setAutoblinker(bool active, int interval = 1, int variation = 4) {
+    autoblinker = active;
+    blinkInterval = interval;
+    blinkVariation = variation;
+  }
+  void setIdleMode(bool active, int interval = 1, int variation = 3) {
+    (void)active;
+    (void)interval;
+    (void)variation;
+  }
+
+  void setPosition(unsigned char position) {
+    int maxX = screenWidth - eyeWidth * 2 - spaceBetween;
+    int maxY = screenHeight - eyeHeightDefault;
+    switch (position) {
+      case N:  eyeXNext = maxX / 2; eyeYNext = 0; break;
+      case NE: eyeXNext = maxX; eyeYNext = 0; break;
+      case E:  eyeXNext = maxX; eyeYNext = maxY / 2; break;
+      case SE: eyeXNext = maxX; eyeYNext = maxY; break;
+      case S:  eyeXNext = maxX / 2; eyeYNext = maxY; break;
+      case SW: eyeXNext = 0; eyeYNext = maxY; break;
+      case W:  eyeXNext = 0; eyeYNext = maxY / 2; break;
+      case NW: eyeXNext = 0; eyeYNext = 0; break;
+      default: eyeXNext = maxX / 2; eyeYNext = maxY / 2; break;
+    }
+  }
+
+  void close() { eyeHeightNext = 1; eyeOpen = false; }
+  void open() { eyeOpen = true; }
+  void blink() { close(); open(); }
+
+private:
+  int eyeXDefault() const { return (screenWidth - (eyeWidth * 2 + spaceBetween)) / 2; }
+  int eyeYDefault() const { return (screenHeight - eyeHeightDefault) / 2; }
+
+  void drawEyes() {
+    int offset = curious ? 8 : 0;
+    bool lookingLeft = eyeXNext <= 10;
+    bool lookingRight = eyeXNext >= screenWidth - eyeWidth * 2 - spaceBetween - 10;
+
+    // Tween towards the target geometry like the real library
+    eyeHeightCurrent = (eyeHeightCurrent + eyeHeightNext) / 2;
+    eyeX = (eyeX + eyeXNext) / 2;
+    eyeY = (eyeY + eyeYNext) / 2;
+    if (eyeOpen && eyeHeightCurrent <= 1 + 1) {
+      eyeHeightNext = eyeHeightDefault;
+    }
+
+    int leftHeight = eyeHeightCurrent + ((curious && lookingLeft) ? offset : 0);
+    int rightHeight = eyeHeightCurrent + ((curious && lookingRight) ? offset : 0);
+    int leftX = eyeX;
+    int rightX = eyeX + eyeWidth + spaceBetween;
+    int leftY = eyeY + (eyeHeightDefault - leftHeight) / 2;
+    int rightY = eyeY + (eyeHeightDefault - rightHeight) / 2;
+
+    display->clearDisplay();
+    display->fillRoundRect(leftX, leftY, eyeWidth, leftHeight, borderRadius, MAINCOLOR);
+    display->fillRoundRect(rightX, rightY, eyeWidth, rightHeight, borderRadius, MAINCOLOR);
+
+    if (tired || angry) {
+      int lid = eyeHeightCurrent / 2;
+      display->fillTriangle(leftX, leftY - 1, leftX + eyeWidth, leftY - 1, tired ? leftX : leftX + eyeWidth, leftY + lid - 1, BGCOLOR);
+      display->fillTriangle(rightX, rightY - 1, rightX + eyeWidth, rightY - 1, tired ? rightX + eyeWidth : rightX, rightY + lid - 1, BGCOLOR);
+    }
+    if (happy) {
+      int lid = eyeHeightCurrent / 2;
+      display->fillRoundRect(leftX - 1, (leftY + leftHeight) - lid + 1, eyeWidth + 2, eyeHeightDefault, borderRadius, BGCOLOR);
+      display->fillRoundRect(rightX - 1, (rightY + rightHeight) - lid + 1, eyeWidth + 2, eyeHeightDefault, borderRadius, BGCOLOR);
+    }
+
+    display->display();
+  }
+
+  AdafruitDisplay* display;
+  int screenWidth = 128;
+  int screenHeight = 64;
+  unsigned long frameInterval = 20;
+  unsigned long fpsTimer = 0;
+
+  bool tired = false;
+  bool angry = false;
+  bool happy = false;
+  bool curious = false;
+  bool eyeOpen = true;
+  bool autoblinker = false;
+  int blinkInterval = 1;
+  int blinkVariation = 4;
+
+  int eyeWidth = 36;
+  int eyeHeightDefault = 36;
+  int eyeHeightCurrent = 1;
+  int eyeHeightNext = 36;
+  int borderRadius = 8;
+  int spaceBetween = 10;
+  int eyeX = 0;
+  int eyeY = 0;
+  int eyeXNext = 0;
+  int eyeYNext = 0;
+};
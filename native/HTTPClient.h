@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+#include "native_hal.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTP_CODE_OK 200
+
+// Reads the mock response body back the way WiFiClient hands out a socket
+class NativeBodyStream : public Stream {
+public:
+  void rewind() { pos_ = 0; }
+  int available() override { return static_cast<int>(native_net_body_size() - pos_); }
+  int read() override { return pos_ < native_net_body_size() ? static_cast<uint8_t>(native_net_body()[pos_++]) : -1; }
+  int peek() override { return pos_ < native_net_body_size() ? static_cast<uint8_t>(native_net_body()[pos_]) : -1; }
+  size_t write(uint8_t c) override { (void)c; return 0; }
+  using Print::write;
+
+private:
+  size_t pos_ = 0;
+};
+
+// No network on the host: every request fails to connect, unless the runner
+// loaded a mock response body, which every GET then returns with 200.
+class HTTPClient {
+public:
+  bool begin(const String& url) { url_ = url; return true; }
+  void end() {}
+  void setTimeout(uint16_t timeout) { (void)timeout; }
+  void setConnectTimeout(int32_t connectTimeout) { (void)connectTimeout; }
+  void useHTTP10(bool usehttp10 = true) { (void)usehttp10; }
+  void addHeader(const String& name, const String& value) { (void)name; (void)value; }
+  int GET() {
+    if (!native_net_online()) {
+      return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+    body_.rewind();
+    return HTTP_CODE_OK;
+  }
+  int getSize() { return native_net_online() ? static_cast<int>(native_net_body_size()) : -1; }
+  Stream& getStream() { return body_; }
+  String getString() { return native_net_online() ? String(std::string(native_net_body(), native_net_body_size())) : String(); }
+  static String errorToString(int error) {
+    return error == HTTPC_ERROR_CONNECTION_REFUSED ? String("connection refused") : String();
+  }
+
+private:
+  String url_;
+  NativeBodyStream body_;
+};
@@ -0,0 +1,127 @@
+#include "Preferences.h"
+#include "native_hal.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+// namespace/key -> value
+std::map<std::string, std::vector<uint8_t> > store;
+
+std::string fullKey(const String& ns, const char* key) {
+  return std::string(ns.c_str()) + "/" + key;
+}
+}  // namespace
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partitionLabel) {
+  NativeHeapExclusion bookkeeping;
+  (void)partitionLabel;
+  namespace_ = name;
+  readOnly_ = readOnly;
+  started_ = true;
+  return true;
+}
+
+void Preferences::end() {
+  started_ = false;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+  NativeHeapExclusion bookkeeping;
+  if (!started_ || readOnly_ || key == nullptr || value == nullptr) {
+    return 0;
+  }
+  const uint8_t* bytes = static_cast<const uint8_t*>(value);
+  store[fullKey(namespace_, key)].assign(bytes, bytes + len);
+  native_hal_nvs_account(len);
+  return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  NativeHeapExclusion bookkeeping;
+  if (!started_) {
+    return 0;
+  }
+  auto it = store.find(fullKey(namespace_, key));
+  return it == store.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  NativeHeapExclusion bookkeeping;
+  if (!started_) {
+    return 0;
+  }
+  auto it = store.find(fullKey(namespace_, key));
+  if (it == store.end() || it->second.size() > maxLen) {
+    return 0;
+  }
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+bool Preferences::isKey(const char* key) {
+  NativeHeapExclusion bookkeeping;
+  return started_ && store.count(fullKey(namespace_, key)) > 0;
+}
+
+bool Preferences::remove(const char* key) {
+  NativeHeapExclusion bookkeeping;
+  if (!started_ || readOnly_) {
+    return false;
+  }
+  return store.erase(fullKey(namespace_, key)) > 0;
+}
+
+bool Preferences::clear() {
+  NativeHeapExclusion bookkeeping;
+  if (!started_ || readOnly_) {
+    return false;
+  }
+  std::string prefix = std::string(namespace_.c_str()) + "/";
+  for (auto it = store.begin(); it != store.end();) {
+    if (it->first.compare(0, prefix.size(), prefix) == 0) {
+      it = store.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return true;
+}
+
+// File format: one entry per line, "<namespace/key> <hex bytes>"
+bool native_nvs_load(const char* path) {
+  NativeHeapExclusion bookkeeping;
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    return false;
+  }
+  char key[64];
+  char hex[1024];
+  while (fscanf(file, "%63s %1023s", key, hex) == 2) {
+    std::vector<uint8_t> value;
+    for (size_t i = 0; hex[i] != '\0' && hex[i + 1] != '\0'; i += 2) {
+      char byte[3] = {hex[i], hex[i + 1], '\0'};
+      value.push_back(static_cast<uint8_t>(strtoul(byte, nullptr, 16)));
+    }
+    store[key] = value;
+  }
+  fclose(file);
+  return true;
+}
+
+bool native_nvs_save(const char* path) {
+  FILE* file = fopen(path, "w");
+  if (file == nullptr) {
+    return false;
+  }
+  for (const auto& entry : store) {
+    fprintf(file, "%s ", entry.first.c_str());
+    for (uint8_t b : entry.second) {
+      fprintf(file, "%02x", b);
+    }
+    fprintf(file, "\n");
+  }
+  fclose(file);
+  return true;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Arduino.h>
+
+// In-memory stand-in for the ESP32 Preferences (NVS) library. Every put
+// that stores bytes counts as one flash write in native_hal_stats(); the
+// runner can load and save the store to a file to simulate a reboot
+// (native_nvs_load / native_nvs_save).
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr);
+  void end();
+
+  size_t putBytes(const char* key, const void* value, size_t len);
+  size_t getBytesLength(const char* key);
+  size_t getBytes(const char* key, void* buf, size_t maxLen);
+  bool isKey(const char* key);
+  bool remove(const char* key);
+  bool clear();
+
+private:
+  String namespace_;
+  bool started_ = false;
+  bool readOnly_ = false;
+};
@@ -0,0 +1,118 @@
+#include "Print.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::write(const char* str) {
+  if (str == nullptr) {
+    return 0;
+  }
+  return write(reinterpret_cast<const uint8_t*>(str), strlen(str));
+}
+
+size_t Print::printf(const char* format, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (len < 0) {
+    return 0;
+  }
+  size_t n = static_cast<size_t>(len) < sizeof(buffer) ? static_cast<size_t>(len) : sizeof(buffer) - 1;
+  return write(reinterpret_cast<const uint8_t*>(buffer), n);
+}
+
+size_t Print::print(const char* str) {
+  return write(str);
+}
+
+size_t Print::print(const String& s) {
+  return write(reinterpret_cast<const uint8_t*>(s.c_str()), s.length());
+}
+
+size_t Print::print(char c) {
+  return write(static_cast<uint8_t>(c));
+}
+
+size_t Print::print(unsigned char n, int base) {
+  return printNumber(n, base);
+}
+
+size_t Print::print(int n, int base) {
+  return print(static_cast<long long>(n), base);
+}
+
+size_t Print::print(unsigned int n, int base) {
+  return printNumber(n, base);
+}
+
+size_t Print::print(long n, int base) {
+  return print(static_cast<long long>(n), base);
+}
+
+size_t Print::print(unsigned long n, int base) {
+  return printNumber(n, base);
+}
+
+size_t Print::print(long long n, int base) {
+  if (base == DEC && n < 0) {
+    size_t t = print('-');
+    return t + printNumber(static_cast<unsigned long long>(-n), DEC);
+  }
+  return printNumber(static_cast<unsigned long long>(n), base);
+}
+
+size_t Print::print(unsigned long long n, int base) {
+  return printNumber(n, base);
+}
+
+size_t Print::print(double n, int digits) {
+  return printFloat(n, digits);
+}
+
+size_t Print::print(const Printable& p) {
+  return p.printTo(*this);
+}
+
+size_t Print::println() {
+  return write(reinterpret_cast<const uint8_t*>("\r\n"), 2);
+}
+
+size_t Print::printNumber(unsigned long long n, int base) {
+  char buf[8 * sizeof(unsigned long long) + 1];
+  char* str = &buf[sizeof(buf) - 1];
+  *str = '\0';
+
+  if (base < 2) {
+    base = 10;
+  }
+
+  do {
+    unsigned long long m = n;
+    n /= base;
+    char c = static_cast<char>(m - base * n);
+    *--str = c < 10 ? c + '0' : c + 'A' - 10;
+  } while (n);
+
+  return write(str);
+}
+
+size_t Print::printFloat(double number, int digits) {
+  if (isnan(number)) return print("nan");
+  if (isinf(number)) return print("inf");
+
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", digits, number);
+  return write(buffer);
+}
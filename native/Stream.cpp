@@ -0,0 +1,82 @@
+#include "Stream.h"
+
+#include <string.h>
+
+bool Stream::find(const char* target) {
+  return findUntil(target, nullptr);
+}
+
+// Same matching as the core: track how far into each pattern the input is
+bool Stream::findUntil(const char* target, const char* terminator) {
+  size_t targetLen = strlen(target);
+  size_t termLen = terminator != nullptr ? strlen(terminator) : 0;
+  size_t targetIndex = 0, termIndex = 0;
+
+  if (targetLen == 0) {
+    return true;
+  }
+
+  int c;
+  while ((c = read()) >= 0) {
+    if (c == target[targetIndex]) {
+      if (++targetIndex >= targetLen) {
+        return true;
+      }
+    } else {
+      targetIndex = (c == target[0]) ? 1 : 0;
+    }
+
+    if (termLen > 0) {
+      if (c == terminator[termIndex]) {
+        if (++termIndex >= termLen) {
+          return false;
+        }
+      } else {
+        termIndex = (c == terminator[0]) ? 1 : 0;
+      }
+    }
+  }
+  return false;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+  size_t count = 0;
+  while (count < length) {
+    int c = read();
+    if (c < 0) {
+      break;
+    }
+    buffer[count++] = static_cast<char>(c);
+  }
+  return count;
+}
+
+size_t Stream::readBytesUntil(char terminator, char* buffer, size_t length) {
+  size_t count = 0;
+  while (count < length) {
+    int c = read();
+    if (c < 0 || c == terminator) {
+      break;
+    }
+    buffer[count++] = static_cast<char>(c);
+  }
+  return count;
+}
+
+String Stream::readString() {
+  String result;
+  int c;
+  while ((c = read()) >= 0) {
+    result += static_cast<char>(c);
+  }
+  return result;
+}
+
+String Stream::readStringUntil(char terminator) {
+  String result;
+  int c;
+  while ((c = read()) >= 0 && c != terminator) {
+    result += static_cast<char>(c);
+  }
+  return result;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Print.h"
+
+// Arduino's Stream: a Print that can also be read from, with the timed
+// search/read helpers the core layers on top of read(). Host streams never
+// wait for data that is not there yet, so the timeout is accepted but unused.
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  void setTimeout(unsigned long timeout) { timeout_ = timeout; }
+  unsigned long getTimeout() const { return timeout_; }
+
+  bool find(const char* target);
+  bool find(char target) { char s[2] = {target, '\0'}; return find(s); }
+  bool findUntil(const char* target, const char* terminator);
+  size_t readBytes(char* buffer, size_t length);
+  size_t readBytes(uint8_t* buffer, size_t length) {
+    return readBytes(reinterpret_cast<char*>(buffer), length);
+  }
+  size_t readBytesUntil(char terminator, char* buffer, size_t length);
+  String readString();
+  String readStringUntil(char terminator);
+
+private:
+  unsigned long timeout_ = 1000;
+};
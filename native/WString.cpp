@@ -0,0 +1,81 @@
+#include "WString.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace {
+std::string formatInteger(unsigned long long value, bool negative, unsigned char base) {
+  if (base < 2 || base > 36) {
+    base = 10;
+  }
+  std::string out;
+  do {
+    unsigned digit = static_cast<unsigned>(value % base);
+    out.insert(out.begin(), static_cast<char>(digit < 10 ? '0' + digit : 'a' + digit - 10));
+    value /= base;
+  } while (value);
+  if (negative) {
+    out.insert(out.begin(), '-');
+  }
+  return out;
+}
+
+std::string formatSigned(long long value, unsigned char base) {
+  if (base == 10 && value < 0) {
+    return formatInteger(static_cast<unsigned long long>(-value), true, base);
+  }
+  return formatInteger(static_cast<unsigned long long>(value), false, base);
+}
+
+std::string formatFloat(double value, unsigned char decimalPlaces) {
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimalPlaces, value);
+  return buffer;
+}
+}  // namespace
+
+String::String(int value, unsigned char base) : s_(formatSigned(value, base)) {}
+String::String(unsigned int value, unsigned char base) : s_(formatInteger(value, false, base)) {}
+String::String(long value, unsigned char base) : s_(formatSigned(value, base)) {}
+String::String(unsigned long value, unsigned char base) : s_(formatInteger(value, false, base)) {}
+String::String(float value, unsigned char decimalPlaces) : s_(formatFloat(value, decimalPlaces)) {}
+String::String(double value, unsigned char decimalPlaces) : s_(formatFloat(value, decimalPlaces)) {}
+
+String String::substring(unsigned int beginIndex) const {
+  return substring(beginIndex, length());
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+  if (beginIndex > endIndex) {
+    unsigned int tmp = endIndex;
+    endIndex = beginIndex;
+    beginIndex = tmp;
+  }
+  if (beginIndex >= length()) {
+    return String();
+  }
+  if (endIndex > length()) {
+    endIndex = length();
+  }
+  return String(s_.substr(beginIndex, endIndex - beginIndex));
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const {
+  size_t pos = s_.find(ch, fromIndex);
+  return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::indexOf(const char* str, unsigned int fromIndex) const {
+  size_t pos = s_.find(str, fromIndex);
+  return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+void String::trim() {
+  size_t begin = s_.find_first_not_of(" \t\r\n");
+  if (begin == std::string::npos) {
+    s_.clear();
+    return;
+  }
+  size_t end = s_.find_last_not_of(" \t\r\n");
+  s_ = s_.substr(begin, end - begin + 1);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string>
+
+// Heap-backed String with the Arduino surface the firmware uses.
+class String {
+public:
+  String() {}
+  String(const char* cstr) : s_(cstr ? cstr : "") {}
+  String(const std::string& str) : s_(str) {}
+  explicit String(char c) : s_(1, c) {}
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(float value, unsigned char decimalPlaces = 2);
+  explicit String(double value, unsigned char decimalPlaces = 2);
+
+  unsigned int length() const { return static_cast<unsigned int>(s_.size()); }
+  const char* c_str() const { return s_.c_str(); }
+  bool isEmpty() const { return s_.empty(); }
+  bool reserve(unsigned int size) { s_.reserve(size); return true; }
+
+  char charAt(unsigned int index) const { return index < s_.size() ? s_[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char& operator[](unsigned int index) { return s_[index]; }
+
+  String substring(unsigned int beginIndex) const;
+  String substring(unsigned int beginIndex, unsigned int endIndex) const;
+  int indexOf(char ch, unsigned int fromIndex = 0) const;
+  int indexOf(const char* str, unsigned int fromIndex = 0) const;
+  bool startsWith(const String& prefix) const { return s_.compare(0, prefix.s_.size(), prefix.s_) == 0; }
+  void trim();
+  int toInt() const { return ::atoi(s_.c_str()); }
+  float toFloat() const { return static_cast<float>(::atof(s_.c_str())); }
+
+  String& operator+=(const String& rhs) { s_ += rhs.s_; return *this; }
+  String& operator+=(const char* rhs) { if (rhs) s_ += rhs; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  String& operator+=(int v) { return *this += String(v); }
+  String& operator+=(unsigned long v) { return *this += String(v); }
+  bool concat(const String& rhs) { s_ += rhs.s_; return true; }
+  bool concat(const char* rhs) { if (rhs) s_ += rhs; return true; }
+
+  bool equals(const String& rhs) const { return s_ == rhs.s_; }
+  bool operator==(const String& rhs) const { return s_ == rhs.s_; }
+  bool operator==(const char* rhs) const { return s_ == (rhs ? rhs : ""); }
+  bool operator!=(const String& rhs) const { return s_ != rhs.s_; }
+  bool operator!=(const char* rhs) const { return !(*this == rhs); }
+  bool operator<(const String& rhs) const { return s_ < rhs.s_; }
+
+  friend String operator+(const String& lhs, const String& rhs) { return String(lhs.s_ + rhs.s_); }
+  friend String operator+(const String& lhs, const char* rhs) { return String(lhs.s_ + (rhs ? rhs : "")); }
+  friend String operator+(const char* lhs, const String& rhs) { return String((lhs ? lhs : "") + rhs.s_); }
+
+private:
+  std::string s_;
+};
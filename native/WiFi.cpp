@@ -0,0 +1,60 @@
+#include "WiFi.h"
+#include "native_hal.h"
+
+#include <string>
+
+WiFiClass WiFi;
+
+namespace {
+std::string mockBody;
+bool mockLoaded = false;
+bool linkUp = true;
+}  // namespace
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* passphrase) {
+  (void)ssid;
+  (void)passphrase;
+  started_ = true;
+  return status();
+}
+
+wl_status_t WiFiClass::status() {
+  return (started_ && native_net_online()) ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+bool native_net_load_body(const char* path) {
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  mockBody.clear();
+  char chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    mockBody.append(chunk, n);
+  }
+  fclose(file);
+  mockLoaded = true;
+  return true;
+}
+
+void native_net_set_body(const char* body, size_t size) {
+  mockBody.assign(body, size);
+  mockLoaded = true;
+}
+
+void native_net_set_link(bool up) {
+  linkUp = up;
+}
+
+bool native_net_online() {
+  return mockLoaded && linkUp;
+}
+
+const char* native_net_body() {
+  return mockBody.data();
+}
+
+size_t native_net_body_size() {
+  return mockBody.size();
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+
+typedef enum {
+  WL_NO_SHIELD = 255,
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2,
+  WIFI_AP_STA = 3
+} wifi_mode_t;
+
+class IPAddress : public Printable {
+public:
+  IPAddress() : bytes_{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes_{a, b, c, d} {}
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", bytes_[0], bytes_[1], bytes_[2], bytes_[3]);
+    return String(buf);
+  }
+  size_t printTo(Print& p) const override { return p.print(toString()); }
+
+private:
+  uint8_t bytes_[4];
+};
+
+// The host has no radio: the station never associates, so the firmware
+// exercises its offline paths, unless the runner loaded a mock response
+// (native_net_load_body), in which case begin() associates immediately.
+class WiFiClass {
+public:
+  bool mode(wifi_mode_t m) { mode_ = m; return true; }
+  wl_status_t begin(const char* ssid, const char* passphrase = nullptr);
+  bool disconnect(bool wifioff = false) { (void)wifioff; started_ = false; return true; }
+  bool reconnect() { return true; }
+  wl_status_t status();
+  IPAddress localIP() { return IPAddress(); }
+  int8_t RSSI() { return 0; }
+  void setAutoReconnect(bool autoReconnect) { (void)autoReconnect; }
+
+private:
+  wifi_mode_t mode_ = WIFI_OFF;
+  bool started_ = false;
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,61 @@
+#include "Wire.h"
+#include "native_hal.h"
+
+namespace {
+const uint16_t SSD1306_I2C_ADDRESS = 0x3C;
+}
+
+TwoWire Wire;
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+  (void)sda;
+  (void)scl;
+  if (frequency != 0) {
+    clockHz_ = frequency;
+  }
+  return true;
+}
+
+bool TwoWire::setClock(uint32_t frequency) {
+  clockHz_ = frequency;
+  return true;
+}
+
+void TwoWire::beginTransmission(uint16_t address) {
+  address_ = address;
+  length_ = 0;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  (void)sendStop;
+  // +1 for the address byte
+  native_hal_i2c_account(length_ + 1, clockHz_);
+  if (address_ == SSD1306_I2C_ADDRESS) {
+    native_ssd1306_receive(buffer_, length_);
+  }
+  length_ = 0;
+  return 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+  if (length_ >= sizeof(buffer_)) {
+    return 0;
+  }
+  buffer_[length_++] = data;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t quantity) {
+  size_t n = 0;
+  while (quantity--) {
+    n += write(*data++);
+  }
+  return n;
+}
+
+uint8_t TwoWire::requestFrom(uint16_t address, uint8_t size, bool sendStop) {
+  (void)address;
+  (void)size;
+  (void)sendStop;
+  return 0;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Arduino.h>
+
+#ifndef I2C_BUFFER_LENGTH
+#define I2C_BUFFER_LENGTH 128
+#endif
+
+// I2C master stand-in. Transmissions are timed against the configured bus
+// clock on the virtual clock, and anything addressed to the SSD1306 is fed
+// to the panel model so the emulated GDDRAM matches what a real panel shows.
+class TwoWire : public Print {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+  bool end() { return true; }
+  bool setClock(uint32_t frequency);
+  uint32_t getClock() const { return clockHz_; }
+
+  void beginTransmission(uint16_t address);
+  uint8_t endTransmission(bool sendStop = true);
+  size_t write(uint8_t data) override;
+  size_t write(const uint8_t* data, size_t quantity) override;
+  using Print::write;
+
+  uint8_t requestFrom(uint16_t address, uint8_t size, bool sendStop = true);
+  int available() { return 0; }
+  int read() { return -1; }
+
+private:
+  uint32_t clockHz_ = 100000;
+  uint16_t address_ = 0;
+  uint8_t buffer_[I2C_BUFFER_LENGTH];
+  size_t length_ = 0;
+};
+
+extern TwoWire Wire;
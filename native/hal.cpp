@@ -0,0 +1,372 @@
+#include <Arduino.h>
+#include "native_hal.h"
+
+#include <deque>
+#include <map>
+#include <random>
+
+namespace {
+const int PIN_COUNT = 64;
+
+struct PinEvent {
+  uint8_t pin;
+  uint8_t level;
+};
+
+struct InterruptSlot {
+  void (*isr)() = nullptr;
+  int mode = 0;
+  bool masked = false;
+};
+
+uint64_t nowUs = 0;
+uint8_t pinLevels[PIN_COUNT];
+uint8_t pinModes[PIN_COUNT];
+InterruptSlot interruptSlots[PIN_COUNT];
+std::multimap<uint64_t, PinEvent> pendingEvents;
+
+int hcsr04Trig = -1;
+int hcsr04Echo = -1;
+uint32_t hcsr04EchoUs = 1200;  // ~20 cm
+
+std::deque<char> serialInput;
+bool serialQuiet = false;
+
+// UART model: 10 bits per byte at the configured baud rate behind the
+// ESP32's 128-byte TX FIFO. Writes return at once while the FIFO has room
+// and block in virtual time once it is full, like the core does with no TX
+// ring buffer configured.
+const uint64_t UART_FIFO_BYTES = 128;
+uint64_t uartByteNs = 10ULL * 1000000000ULL / 115200ULL;
+uint64_t uartDrainedAtNs = 0;  // when the last queued byte leaves the wire
+
+NativeHalStats stats = {};
+std::mt19937 rng(1);
+
+void setLevel(uint8_t pin, uint8_t level) {
+  if (pin >= PIN_COUNT) {
+    return;
+  }
+  uint8_t previous = pinLevels[pin];
+  pinLevels[pin] = level ? HIGH : LOW;
+  if (previous == pinLevels[pin]) {
+    return;
+  }
+
+  const InterruptSlot& slot = interruptSlots[pin];
+  if (slot.isr == nullptr || slot.masked) {
+    return;
+  }
+  bool rising = (pinLevels[pin] == HIGH);
+  if (slot.mode == CHANGE || (slot.mode == RISING && rising) ||
+      (slot.mode == FALLING && !rising)) {
+    slot.isr();
+  }
+}
+
+// Advance virtual time to `target`, applying scheduled pin edges on the way
+void runUntil(uint64_t target) {
+  while (!pendingEvents.empty() && pendingEvents.begin()->first <= target) {
+    auto it = pendingEvents.begin();
+    nowUs = std::max(nowUs, it->first);
+    PinEvent event = it->second;
+    {
+      NativeHeapExclusion bookkeeping;
+      pendingEvents.erase(it);
+    }
+    setLevel(event.pin, event.level);
+  }
+  nowUs = std::max(nowUs, target);
+}
+
+struct PinInit {
+  PinInit() {
+    for (int i = 0; i < PIN_COUNT; i++) {
+      pinLevels[i] = LOW;
+      pinModes[i] = INPUT;
+    }
+  }
+} pinInit;
+}  // namespace
+
+// ============================================================================
+// HAL CONTROL
+// ============================================================================
+
+uint64_t native_hal_now_us() {
+  return nowUs;
+}
+
+void native_hal_advance_us(uint64_t us) {
+  runUntil(nowUs + us);
+}
+
+void native_hal_schedule_pin(uint8_t pin, uint8_t level, uint64_t atUs) {
+  NativeHeapExclusion bookkeeping;
+  pendingEvents.insert({atUs, PinEvent{pin, level}});
+}
+
+void native_hal_set_pin(uint8_t pin, uint8_t level) {
+  setLevel(pin, level);
+}
+
+void native_hal_mask_pin_interrupt(uint8_t pin, bool masked) {
+  if (pin < PIN_COUNT) {
+    interruptSlots[pin].masked = masked;
+  }
+}
+
+void native_hal_attach_hcsr04(uint8_t trigPin, uint8_t echoPin) {
+  hcsr04Trig = trigPin;
+  hcsr04Echo = echoPin;
+}
+
+void native_hal_set_echo_us(uint32_t echoUs) {
+  hcsr04EchoUs = echoUs;
+}
+
+void native_hal_serial_feed(const char* text) {
+  NativeHeapExclusion bookkeeping;
+  while (text && *text) {
+    serialInput.push_back(*text++);
+  }
+}
+
+void native_hal_set_quiet(bool quiet) {
+  serialQuiet = quiet;
+}
+
+const NativeHalStats& native_hal_stats() {
+  return stats;
+}
+
+void native_hal_reset_stats() {
+  stats = NativeHalStats{};
+}
+
+void native_hal_nvs_account(size_t bytes) {
+  stats.nvsWrites++;
+  stats.nvsBytes += bytes;
+}
+
+void native_hal_pixel_account(uint32_t pixels) {
+  stats.pixelWrites += pixels;
+}
+
+void native_hal_i2c_account(size_t bytes, uint32_t clockHz) {
+  if (clockHz == 0) {
+    clockHz = 100000;
+  }
+  // 9 clocks per byte (8 data + ACK) plus start/stop overhead
+  uint64_t busUs = ((bytes * 9ULL + 2ULL) * 1000000ULL) / clockHz;
+  stats.i2cBytes += bytes;
+  stats.i2cTransactions++;
+  stats.i2cBusUs += busUs;
+  runUntil(nowUs + busUs);
+}
+
+// ============================================================================
+// ARDUINO CORE
+// ============================================================================
+
+unsigned long millis() {
+  return static_cast<unsigned long>(nowUs / 1000ULL);
+}
+
+unsigned long micros() {
+  return static_cast<unsigned long>(nowUs);
+}
+
+void delay(uint32_t ms) {
+  stats.delayUs += static_cast<uint64_t>(ms) * 1000ULL;
+  runUntil(nowUs + static_cast<uint64_t>(ms) * 1000ULL);
+}
+
+void delayMicroseconds(uint32_t us) {
+  stats.delayUs += us;
+  runUntil(nowUs + us);
+}
+
+void yield() {}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin >= PIN_COUNT) {
+    return;
+  }
+  pinModes[pin] = mode;
+  if (mode == INPUT_PULLUP) {
+    pinLevels[pin] = HIGH;
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin >= PIN_COUNT) {
+    return;
+  }
+  bool falling = (pinLevels[pin] == HIGH && val == LOW);
+  setLevel(pin, val);
+
+  if (falling && pin == hcsr04Trig && hcsr04Echo >= 0 && hcsr04EchoUs > 0) {
+    // The HC-SR04 starts its echo ~450 us after the trigger burst
+    uint64_t riseAt = nowUs + 450;
+    native_hal_schedule_pin(static_cast<uint8_t>(hcsr04Echo), HIGH, riseAt);
+    native_hal_schedule_pin(static_cast<uint8_t>(hcsr04Echo), LOW, riseAt + hcsr04EchoUs);
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= PIN_COUNT) {
+    return LOW;
+  }
+  return pinLevels[pin];
+}
+
+unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeout) {
+  const uint64_t start = nowUs;
+  const uint64_t deadline = start + timeout;
+  unsigned long result = 0;
+
+  auto waitFor = [&](uint8_t level) {
+    while (digitalRead(pin) != level) {
+      if (pendingEvents.empty() || pendingEvents.begin()->first > deadline) {
+        runUntil(deadline);
+        return false;
+      }
+      runUntil(pendingEvents.begin()->first);
+    }
+    return true;
+  };
+
+  // Same shape as the core: wait out a pulse in progress, then time the next
+  if (waitFor(!state) && waitFor(state)) {
+    uint64_t pulseStart = nowUs;
+    if (waitFor(!state)) {
+      result = static_cast<unsigned long>(nowUs - pulseStart);
+    }
+  }
+
+  stats.pulseInUs += nowUs - start;
+  return result;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode) {
+  if (pin < PIN_COUNT) {
+    interruptSlots[pin].isr = isr;
+    interruptSlots[pin].mode = mode;
+  }
+}
+
+void detachInterrupt(uint8_t pin) {
+  if (pin < PIN_COUNT) {
+    interruptSlots[pin] = InterruptSlot{};
+  }
+}
+
+void noInterrupts() {}
+void interrupts() {}
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration) {
+  (void)pin;
+  (void)duration;
+  stats.lastToneHz = frequency;
+}
+
+void noTone(uint8_t pin) {
+  (void)pin;
+  stats.lastToneHz = 0;
+}
+
+void randomSeed(unsigned long seed) {
+  rng.seed(static_cast<std::mt19937::result_type>(seed));
+}
+
+long random(long howbig) {
+  if (howbig <= 0) {
+    return 0;
+  }
+  return static_cast<long>(rng() % static_cast<unsigned long>(howbig));
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) {
+    return howsmall;
+  }
+  return howsmall + random(howbig - howsmall);
+}
+
+// ============================================================================
+// SERIAL
+// ============================================================================
+
+HardwareSerial Serial;
+
+namespace {
+uint64_t uartQueuedBytes() {
+  uint64_t nowNs = nowUs * 1000ULL;
+  if (uartDrainedAtNs <= nowNs) {
+    return 0;
+  }
+  return (uartDrainedAtNs - nowNs + uartByteNs - 1) / uartByteNs;
+}
+
+void uartQueue(size_t bytes) {
+  for (size_t i = 0; i < bytes; i++) {
+    if (uartQueuedBytes() >= UART_FIFO_BYTES) {
+      // Wait for one slot: until only FIFO - 1 bytes are left to send
+      uint64_t slotFreeNs = uartDrainedAtNs - (UART_FIFO_BYTES - 1) * uartByteNs;
+      uint64_t waitUs = (slotFreeNs - nowUs * 1000ULL + 999ULL) / 1000ULL;
+      stats.serialBlockedUs += waitUs;
+      runUntil(nowUs + waitUs);
+    }
+    uartDrainedAtNs = std::max<uint64_t>(uartDrainedAtNs, nowUs * 1000ULL) + uartByteNs;
+  }
+}
+}  // namespace
+
+void HardwareSerial::begin(unsigned long baud) {
+  if (baud > 0) {
+    uartByteNs = 10ULL * 1000000000ULL / baud;
+  }
+}
+
+int HardwareSerial::availableForWrite() {
+  return static_cast<int>(UART_FIFO_BYTES - std::min(uartQueuedBytes(), UART_FIFO_BYTES));
+}
+
+int HardwareSerial::available() {
+  return static_cast<int>(serialInput.size());
+}
+
+int HardwareSerial::read() {
+  if (serialInput.empty()) {
+    return -1;
+  }
+  char c = serialInput.front();
+  NativeHeapExclusion bookkeeping;
+  serialInput.pop_front();
+  return static_cast<unsigned char>(c);
+}
+
+int HardwareSerial::peek() {
+  return serialInput.empty() ? -1 : static_cast<unsigned char>(serialInput.front());
+}
+
+void HardwareSerial::flush() {
+  fflush(stdout);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  uartQueue(1);
+  if (!serialQuiet) {
+    fputc(c, stdout);
+  }
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  uartQueue(size);
+  if (!serialQuiet) {
+    fwrite(buffer, 1, size, stdout);
+  }
+  return size;
+}
@@ -0,0 +1,91 @@
+// Heap accounting for the host build. On glibc the allocator entry points
+// are replaced with thin wrappers around the __libc_* originals, so every
+// allocation the firmware makes (String, ArduinoJson, operator new) shows
+// up in native_hal_heap(). Other hosts report zeros.
+
+#include "native_hal.h"
+
+#include <stdlib.h>
+
+namespace {
+NativeHeapStats heap = {};
+int excludeDepth = 0;
+
+void account(size_t added, size_t removed) {
+  // Blocks from allocators that are not wrapped (aligned_alloc) may still
+  // come back through free(); never let them drive the count negative
+  uint64_t total = heap.currentBytes + added;
+  heap.currentBytes = total > removed ? total - removed : 0;
+  if (heap.currentBytes > heap.peakBytes) {
+    heap.peakBytes = heap.currentBytes;
+  }
+}
+}  // namespace
+
+const NativeHeapStats& native_hal_heap() {
+  return heap;
+}
+
+void native_hal_reset_heap_peak() {
+  heap.peakBytes = heap.currentBytes;
+  heap.allocations = 0;
+}
+
+NativeHeapExclusion::NativeHeapExclusion() {
+  excludeDepth++;
+}
+
+NativeHeapExclusion::~NativeHeapExclusion() {
+  excludeDepth--;
+}
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+  void* ptr = __libc_malloc(size);
+  if (ptr != nullptr && excludeDepth == 0) {
+    heap.allocations++;
+    account(malloc_usable_size(ptr), 0);
+  }
+  return ptr;
+}
+
+void* calloc(size_t count, size_t size) {
+  void* ptr = __libc_calloc(count, size);
+  if (ptr != nullptr && excludeDepth == 0) {
+    heap.allocations++;
+    account(malloc_usable_size(ptr), 0);
+  }
+  return ptr;
+}
+
+void* realloc(void* ptr, size_t size) {
+  size_t before = ptr != nullptr ? malloc_usable_size(ptr) : 0;
+  void* result = __libc_realloc(ptr, size);
+  if (excludeDepth > 0) {
+    return result;
+  }
+  if (result != nullptr) {
+    heap.allocations++;
+    account(malloc_usable_size(result), before);
+  } else if (size == 0) {
+    account(0, before);
+  }
+  return result;
+}
+
+void free(void* ptr) {
+  if (ptr != nullptr && excludeDepth == 0) {
+    account(0, malloc_usable_size(ptr));
+  }
+  __libc_free(ptr);
+}
+}
+#endif
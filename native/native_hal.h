@@ -0,0 +1,100 @@
+#pragma once
+
+// Control surface of the host HAL. Firmware code never includes this; it is
+// used by the native runner (native_main.cpp) to script inputs and read the
+// counters that the benchmarks report.
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Virtual clock
+uint64_t native_hal_now_us();
+void native_hal_advance_us(uint64_t us);
+
+// Drive an input pin at an absolute virtual time (fires attached ISRs)
+void native_hal_schedule_pin(uint8_t pin, uint8_t level, uint64_t atUs);
+void native_hal_set_pin(uint8_t pin, uint8_t level);
+// Keep a pin's ISR attached but let its edges go unseen, like a GPIO armed
+// for light-sleep wakeup
+void native_hal_mask_pin_interrupt(uint8_t pin, bool masked);
+
+// HC-SR04 model: a falling edge on trigPin produces an echo pulse on echoPin
+// of echoUs microseconds (0 = nothing in range, pulseIn times out)
+void native_hal_attach_hcsr04(uint8_t trigPin, uint8_t echoPin);
+void native_hal_set_echo_us(uint32_t echoUs);
+
+// Serial input injection (for serial commands)
+void native_hal_serial_feed(const char* text);
+
+// Output muting: Serial output is discarded while quiet
+void native_hal_set_quiet(bool quiet);
+
+// Counters
+struct NativeHalStats {
+  uint64_t delayUs;        // virtual time spent inside delay()/delayMicroseconds()
+  uint64_t pulseInUs;      // virtual time spent blocked in pulseIn()
+  uint64_t serialBlockedUs; // virtual time spent waiting for UART FIFO space
+  uint64_t i2cBytes;       // bytes clocked over the I2C bus (incl. address byte)
+  uint64_t i2cTransactions;
+  uint64_t i2cBusUs;       // virtual time the bus was busy
+  uint32_t lastToneHz;     // last frequency passed to tone()
+  uint64_t nvsWrites;      // Preferences puts that stored data (flash writes)
+  uint64_t nvsBytes;       // bytes stored by those puts
+  uint64_t pixelWrites;    // framebuffer pixels set, cleared or inverted
+};
+
+const NativeHalStats& native_hal_stats();
+void native_hal_reset_stats();
+
+// Heap accounting: every malloc/free on the host (glibc only; zeros elsewhere)
+struct NativeHeapStats {
+  uint64_t currentBytes;   // bytes currently allocated
+  uint64_t peakBytes;      // high-water mark since the last reset
+  uint64_t allocations;    // number of allocation calls
+};
+
+const NativeHeapStats& native_hal_heap();
+void native_hal_reset_heap_peak();
+
+// While one of these is alive, allocations and frees are left out of
+// native_hal_heap(). The stand-ins use it for their own bookkeeping (the
+// scheduled pin edges, the NVS map), which the device does not have.
+class NativeHeapExclusion {
+public:
+  NativeHeapExclusion();
+  ~NativeHeapExclusion();
+};
+
+// Mock network: once a response body is loaded, WiFi associates and every
+// HTTP GET answers 200 with that body, read back as a stream
+bool native_net_load_body(const char* path);
+void native_net_set_body(const char* body, size_t size);
+// Take the access point away (or bring it back); a lost link drops the
+// association and fails requests until it returns
+void native_net_set_link(bool up);
+bool native_net_online();
+const char* native_net_body();
+size_t native_net_body_size();
+
+// NVS stand-in (Preferences): persist the key/value store across runs to
+// simulate a reboot, and the hook that counts flash writes
+bool native_nvs_load(const char* path);
+bool native_nvs_save(const char* path);
+void native_hal_nvs_account(size_t bytes);
+
+// Framebuffer hook used by the SSD1306 stand-in
+void native_hal_pixel_account(uint32_t pixels);
+
+// I2C bus hooks used by the Wire stand-in
+void native_hal_i2c_account(size_t bytes, uint32_t clockHz);
+
+// SSD1306 panel model attached to the I2C bus: tracks the controller's GDDRAM
+// as written by page/column addressed data so flush strategies can be verified
+const uint8_t* native_ssd1306_gddram();
+bool native_ssd1306_scrolling();
+// Panel frame rate driving the scroll (0 = the nominal 105 Hz); the firmware
+// cannot read it back, so tests skew it to model oscillator tolerance
+void native_ssd1306_set_frame_hz(uint32_t hz);
+// RAM writes (or scroll setups) sent while a scroll was running
+uint32_t native_ssd1306_scroll_violations();
+void native_ssd1306_receive(const uint8_t* data, size_t len);
@@ -0,0 +1,827 @@
+// Entry point for [env:native]: runs setup() once and loop() until the
+// requested amount of virtual device time has passed, then reports where
+// the time went. Host time is measured with a steady clock around each
+// loop() call; virtual time is what the device would have spent.
+//
+// Usage: program [seconds] [--press PIN@MS[:HOLD_MS]]... [--echo US] [--menu FILE]
+//                [--command MS:TEXT]... [--bounce N] [--nvs FILE] [--banner-hw] [--verbose]
+//        program --history-bench N
+//        program --log-bench N
+//        program --glyph-bench N
+//        program --banner-bench N
+//        program --text-bench N
+//   seconds   virtual run length after setup (default 60)
+//   --press   pull PIN low at MS after setup for HOLD_MS (default 80 ms)
+//   --echo    HC-SR04 echo width in us, 0 = no echo (default 1200)
+//   --menu    bring WiFi up and answer every HTTP GET with FILE (mock server)
+//   --bounce  add N contact bounces (300 us apart) to every press and release
+//   --command type TEXT and a newline on the serial console at MS after setup
+//   --nvs     load the NVS store from FILE before setup and save it back at
+//             the end; a second run with the same FILE is a reboot
+//   --banner-hw let the panel controller scroll the idle banner
+//   --verbose keep the firmware's Serial output
+//   --history-bench  append N synthetic sessions to an empty history log,
+//             time appends, queries and the boot scan, then exit
+//   --log-bench      run N loop iterations that log the presence check line
+//             with logging compiled out, through the log ring and straight
+//             to Serial, report the time each costs the loop, then exit
+//   --glyph-bench    draw the MM:SS timer N times through the GFX font and
+//             through the glyph atlas, check both give the same pixels, then exit
+//   --banner-bench   draw every frame of the banner ticker (holds and
+//             scrolls through all messages) N times through the GFX font and
+//             from the pre-rendered strip, compare the pixels, then exit
+//   --text-bench     wrap and draw N synthetic UTF-8 dish titles the old way
+//             (byte-wise through GFX) and through the text engine, report the
+//             glyph cache hit rate, check ASCII titles match GFX, then exit
+
+// `pio test -e native` links the firmware and native/ into each test, which
+// brings its own main(); the runner is left out of those builds.
+#if !defined(PIO_UNIT_TESTING)
+
+#include <Arduino.h>
+#include "native_hal.h"
+#include "ultrasound.h"
+#include "monitor.h"
+#include "log.h"
+#include "buttons.h"
+#include "power.h"
+#include "boot.h"
+#include "persist.h"
+#include "history.h"
+#include "atlas.h"
+#include "text.h"
+#include "format.h"
+#include "profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace {
+struct Press {
+  uint8_t pin;
+  uint64_t atMs;
+  uint64_t holdMs;
+};
+
+struct Command {
+  uint64_t atMs;
+  std::string text;
+};
+
+typedef std::chrono::steady_clock HostClock;
+
+uint64_t hostNs(HostClock::time_point from, HostClock::time_point to) {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+}
+
+bool parsePress(const char* spec, Press* press) {
+  unsigned pin = 0;
+  unsigned long long at = 0, hold = 80;
+  int fields = sscanf(spec, "%u@%llu:%llu", &pin, &at, &hold);
+  if (fields < 2) {
+    return false;
+  }
+  press->pin = static_cast<uint8_t>(pin);
+  press->atMs = at;
+  press->holdMs = hold;
+  return true;
+}
+bool parseCommand(const char* spec, Command* command) {
+  const char* colon = strchr(spec, ':');
+  if (colon == nullptr || colon == spec) {
+    return false;
+  }
+  command->atMs = strtoull(spec, nullptr, 10);
+  command->text = std::string(colon + 1) + "\n";
+  return true;
+}
+
+// Times the history log on the host RAM image: append and query cost, and
+// the head scan history_init() does at boot
+int runHistoryBench(uint32_t count) {
+  native_hal_set_quiet(true);
+  history_init();
+  history_clear();
+
+  uint64_t appendTotalNs = 0, appendMaxNs = 0;
+  uint64_t queryTotalNs = 0, queryMaxNs = 0;
+  uint32_t queries = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    // 12 sessions a day, two work sessions to each break
+    HistoryRecord record = {};
+    record.startMinute = i * 120;
+    record.kind = i % 3 == 2 ? HISTORY_SHORT_BREAK : HISTORY_WORK;
+    record.completed = i % 10 != 0;
+    record.actualSeconds = record.kind == HISTORY_WORK ? 1500 : 300;
+    record.plannedMinutes = record.kind == HISTORY_WORK ? 25 : 5;
+
+    HostClock::time_point start = HostClock::now();
+    history_append(record);
+    uint64_t ns = hostNs(start, HostClock::now());
+    appendTotalNs += ns;
+    appendMaxNs = std::max(appendMaxNs, ns);
+
+    if (i % 100 == 0) {
+      HistoryTotals totals;
+      start = HostClock::now();
+      history_get_totals(&totals);
+      ns = hostNs(start, HostClock::now());
+      queryTotalNs += ns;
+      queryMaxNs = std::max(queryMaxNs, ns);
+      queries++;
+    }
+  }
+
+  HistoryTotals totals;
+  history_get_totals(&totals);
+  HistoryRecord oldest;
+  bool haveOldest = totals.records > 0 && history_read(totals.records - 1, &oldest);
+
+  HostClock::time_point start = HostClock::now();
+  history_init();
+  uint64_t initNs = hostNs(start, HostClock::now());
+  HistoryTotals reloaded;
+  history_get_totals(&reloaded);
+
+  fprintf(stderr, "history bench: %lu sessions appended, %lu kept in %lu bytes of flash\n",
+          static_cast<unsigned long>(count), static_cast<unsigned long>(totals.records),
+          static_cast<unsigned long>(HISTORY_HOST_FLASH_SIZE));
+  fprintf(stderr, "  append: mean %.0f ns, max %llu ns\n",
+          count > 0 ? static_cast<double>(appendTotalNs) / count : 0.0,
+          static_cast<unsigned long long>(appendMaxNs));
+  fprintf(stderr, "  totals query: mean %.0f ns, max %llu ns (%lu queries)\n",
+          queries > 0 ? static_cast<double>(queryTotalNs) / queries : 0.0,
+          static_cast<unsigned long long>(queryMaxNs), static_cast<unsigned long>(queries));
+  fprintf(stderr, "  boot scan: %.3f ms, totals %s after reload\n", initNs / 1e6,
+          reloaded.weekFocusSeconds == totals.weekFocusSeconds &&
+          reloaded.weekSessions == totals.weekSessions && reloaded.records == totals.records
+              ? "match" : "DIFFER");
+  fprintf(stderr, "  last %d days: %lu min focus in %u sessions, today %lu min\n", HISTORY_WINDOW_DAYS,
+          static_cast<unsigned long>(totals.weekFocusSeconds / 60), totals.weekSessions,
+          static_cast<unsigned long>(totals.todayFocusSeconds / 60));
+  if (haveOldest) {
+    fprintf(stderr, "  oldest kept record: minute %lu\n", static_cast<unsigned long>(oldest.startMinute));
+  }
+  return 0;
+}
+
+// One way of getting a loop iteration's log lines out
+enum class LogPath {
+  OFF,       // what LOG_x() compiles to below the threshold: nothing
+  BUFFERED,  // log_write() into the ring, log_update() feeds the UART
+  DIRECT     // formatted and written to Serial in place, as before the logger
+};
+
+struct LogPassResult {
+  uint64_t hostTotalNs;
+  uint64_t hostMaxNs;
+  uint64_t blockedTotalUs;
+  uint64_t blockedMaxUs;
+  uint32_t dropped;
+};
+
+// `count` loop iterations 10 ms apart, each logging the presence check line;
+// every 100th also logs a burst of `burst` lines, like a state change or
+// the profiler report
+LogPassResult runLogPass(LogPath path, uint32_t count, uint32_t burst) {
+  // Let the UART and the ring empty from the previous pass
+  native_hal_advance_us(1000000);
+  log_update();
+  native_hal_reset_stats();
+  uint32_t droppedBefore = log_dropped_count();
+
+  LogPassResult result = {};
+  for (uint32_t i = 0; i < count; i++) {
+    native_hal_advance_us(10000);
+    uint32_t lines = i % 100 == 0 ? 1 + burst : 1;
+    float distance = 80.0f + (i % 37) * 0.25f;
+    uint64_t blockedBefore = native_hal_stats().serialBlockedUs;
+
+    HostClock::time_point start = HostClock::now();
+    for (uint32_t line = 0; line < lines; line++) {
+      if (path == LogPath::BUFFERED) {
+        log_write(LOG_LEVEL_DEBUG, LOG_APP, "Distance check #%lu: %.2f cm",
+                  static_cast<unsigned long>(i + line), distance);
+      } else if (path == LogPath::DIRECT) {
+        char text[LOG_LINE_MAX];
+        int length = snprintf(text, sizeof(text), "[%lu][D][app] Distance check #%lu: %.2f cm\r\n",
+                              millis(), static_cast<unsigned long>(i + line), distance);
+        Serial.write(reinterpret_cast<const uint8_t*>(text), static_cast<size_t>(length));
+      }
+    }
+    if (path == LogPath::BUFFERED) {
+      log_update();
+    }
+    uint64_t ns = hostNs(start, HostClock::now());
+
+    uint64_t blocked = native_hal_stats().serialBlockedUs - blockedBefore;
+    result.hostTotalNs += ns;
+    result.hostMaxNs = std::max(result.hostMaxNs, ns);
+    result.blockedTotalUs += blocked;
+    result.blockedMaxUs = std::max(result.blockedMaxUs, blocked);
+  }
+  result.dropped = log_dropped_count() - droppedBefore;
+  return result;
+}
+
+// Loop time spent on logging with it compiled out, through the buffered
+// logger, and written straight to the 115200 baud UART
+int runLogBench(uint32_t count) {
+  native_hal_set_quiet(true);
+  const uint32_t burst = 12;
+  static const char* const names[] = {"off", "buffered", "direct Serial"};
+  const LogPath paths[] = {LogPath::OFF, LogPath::BUFFERED, LogPath::DIRECT};
+
+  fprintf(stderr, "log bench: %lu loop iterations 10 ms apart, one line each plus %lu every 100th (ring %d bytes)\n",
+          static_cast<unsigned long>(count), static_cast<unsigned long>(burst), LOG_BUFFER_SIZE);
+  double n = count > 0 ? static_cast<double>(count) : 1.0;
+  for (int p = 0; p < 3; p++) {
+    LogPassResult result = runLogPass(paths[p], count, burst);
+    fprintf(stderr, "  %-13s host %.0f ns/loop (max %llu ns), loop blocked %.1f us/loop (max %.1f ms), %lu dropped\n",
+            names[p], result.hostTotalNs / n, static_cast<unsigned long long>(result.hostMaxNs),
+            result.blockedTotalUs / n, result.blockedMaxUs / 1000.0, static_cast<unsigned long>(result.dropped));
+  }
+  return 0;
+}
+
+// Timer digits at size 3 through Adafruit GFX (fillRect per font pixel)
+// versus the pre-rendered atlas (byte copies per page)
+int runGlyphBench(uint32_t count) {
+  native_hal_set_quiet(true);
+  Adafruit_SSD1306 gfx(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+  Adafruit_SSD1306 atlas(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+  if (!gfx.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS) || !atlas.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS)) {
+    fprintf(stderr, "glyph bench: no framebuffer\n");
+    return 1;
+  }
+  const size_t frameBytes = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+  const int16_t timerX = 15;
+  const int16_t cellX = timerX + 4 * ATLAS_TIMER_CELL_WIDTH;  // last digit
+
+  uint64_t gfxTextNs = 0, atlasTextNs = 0, gfxCellNs = 0, atlasCellNs = 0;
+  uint32_t mismatches = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    char text[FORMAT_TIME_SIZE];
+    format_time(text, sizeof(text), 1500 - i % 1501);
+
+    // Whole timer: clear its rows, print the string
+    HostClock::time_point start = HostClock::now();
+    gfx.fillRect(timerX, ATLAS_TIMER_Y, SCREEN_WIDTH - timerX, 24, SSD1306_BLACK);
+    gfx.setTextColor(SSD1306_WHITE);
+    gfx.setTextSize(3);
+    gfx.setCursor(timerX, ATLAS_TIMER_Y);
+    gfx.println(text);
+    gfxTextNs += hostNs(start, HostClock::now());
+
+    start = HostClock::now();
+    atlas.fillRect(timerX + 5 * ATLAS_TIMER_CELL_WIDTH, ATLAS_TIMER_Y,
+                   SCREEN_WIDTH - timerX - 5 * ATLAS_TIMER_CELL_WIDTH, 24, SSD1306_BLACK);
+    atlas_draw_timer(atlas.getBuffer(), timerX, text);
+    atlasTextNs += hostNs(start, HostClock::now());
+
+    mismatches += memcmp(gfx.getBuffer(), atlas.getBuffer(), frameBytes) != 0;
+
+    // One digit cell, as the running screen redraws it every second
+    char digit = text[4];
+    start = HostClock::now();
+    gfx.fillRect(cellX, ATLAS_TIMER_Y, ATLAS_TIMER_CELL_WIDTH, 24, SSD1306_BLACK);
+    gfx.setCursor(cellX, ATLAS_TIMER_Y);
+    gfx.write(static_cast<uint8_t>(digit));
+    gfxCellNs += hostNs(start, HostClock::now());
+
+    start = HostClock::now();
+    atlas_copy(atlas.getBuffer(), cellX, *atlas_timer_glyph(digit), ATLAS_TIMER_PAGE_MASKS);
+    atlasCellNs += hostNs(start, HostClock::now());
+
+    mismatches += memcmp(gfx.getBuffer(), atlas.getBuffer(), frameBytes) != 0;
+  }
+
+  double n = count > 0 ? count : 1;
+  fprintf(stderr, "glyph bench: %lu timer draws\n", static_cast<unsigned long>(count));
+  fprintf(stderr, "  MM:SS via GFX println: %.0f ns, via atlas: %.0f ns (%.1fx)\n",
+          gfxTextNs / n, atlasTextNs / n, atlasTextNs > 0 ? static_cast<double>(gfxTextNs) / atlasTextNs : 0.0);
+  fprintf(stderr, "  one digit cell via GFX: %.0f ns, via atlas: %.0f ns (%.1fx)\n",
+          gfxCellNs / n, atlasCellNs / n, atlasCellNs > 0 ? static_cast<double>(gfxCellNs) / atlasCellNs : 0.0);
+  fprintf(stderr, "  framebuffers %s\n", mismatches == 0 ? "identical" : "DIFFER");
+  return mismatches == 0 ? 0 : 1;
+}
+
+// One idle-screen ticker frame: `index` held (offset < 0) or scrolled
+// `offset` columns towards the next message
+struct BannerFrame {
+  int index;
+  int offset;
+};
+
+// The ticker as monitor.cpp drew it before the strip: clear the footer,
+// measure both messages, print them
+void drawBannerGfx(Adafruit_SSD1306& gfx, const BannerFrame& frame, int16_t y) {
+  const int count = ATLAS_BANNER_COUNT;
+  const char* current = monitor_get_banner_message(frame.index);
+  const char* next = monitor_get_banner_message((frame.index + 1) % count);
+  int16_t x1, y1;
+  uint16_t currentWidth, nextWidth, h;
+  gfx.fillRect(0, 49, SCREEN_WIDTH, SCREEN_HEIGHT - 49, SSD1306_BLACK);
+  gfx.setTextSize(1);
+  gfx.getTextBounds(current, 0, 0, &x1, &y1, &currentWidth, &h);
+  if (frame.offset < 0) {
+    gfx.setCursor(currentWidth <= SCREEN_WIDTH ? (SCREEN_WIDTH - currentWidth) / 2 : 0, y);
+    gfx.print(current);
+    return;
+  }
+  gfx.getTextBounds(next, 0, 0, &x1, &y1, &nextWidth, &h);
+  if (currentWidth - frame.offset > 0) {
+    gfx.setCursor(-frame.offset, y);
+    gfx.print(current);
+  }
+  int nextX = currentWidth + SCREEN_WIDTH - frame.offset;
+  if (nextX < SCREEN_WIDTH) {
+    gfx.setCursor(nextX, y);
+    gfx.print(next);
+  }
+}
+
+void placeBannerColumns(uint8_t* window, int x, const AtlasSpan& span) {
+  int first = x < 0 ? -x : 0;
+  int last = x + span.width > SCREEN_WIDTH ? SCREEN_WIDTH - x : span.width;
+  if (first < last) {
+    memcpy(window + x + first, ATLAS_BANNER_STRIP + span.offset + first, last - first);
+  }
+}
+
+// The same frame as a window over the strip (see drawBanner() in monitor.cpp)
+void drawBannerStrip(uint8_t* framebuffer, const BannerFrame& frame, int16_t y) {
+  uint8_t window[SCREEN_WIDTH];
+  memset(window, 0, sizeof(window));
+  const AtlasSpan& current = ATLAS_BANNER_SPANS[frame.index];
+  if (frame.offset < 0) {
+    placeBannerColumns(window, current.width <= SCREEN_WIDTH ? (SCREEN_WIDTH - current.width) / 2 : 0, current);
+  } else {
+    placeBannerColumns(window, -frame.offset, current);
+    placeBannerColumns(window, current.width + SCREEN_WIDTH - frame.offset,
+                       ATLAS_BANNER_SPANS[(frame.index + 1) % ATLAS_BANNER_COUNT]);
+  }
+  atlas_copy_rows(framebuffer, y, window);
+}
+
+// Ticker frames through Adafruit GFX (getTextBounds and a pixel per font
+// dot) versus the window copy from the pre-rendered banner strip
+int runBannerBench(uint32_t rounds) {
+  native_hal_set_quiet(true);
+  Adafruit_SSD1306 gfx(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+  Adafruit_SSD1306 strip(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+  if (!gfx.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS) || !strip.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS)) {
+    fprintf(stderr, "banner bench: no framebuffer\n");
+    return 1;
+  }
+  gfx.setTextWrap(false);
+  gfx.setTextColor(SSD1306_WHITE);
+  // The separator line above the banner must survive both paths
+  gfx.drawLine(0, 48, 127, 48, SSD1306_WHITE);
+  strip.drawLine(0, 48, 127, 48, SSD1306_WHITE);
+
+  // Every frame the idle screen shows in one pass through the messages
+  std::vector<BannerFrame> frames;
+  for (int i = 0; i < ATLAS_BANNER_COUNT; i++) {
+    frames.push_back(BannerFrame{i, -1});
+    int transition = ATLAS_BANNER_SPANS[i].width + SCREEN_WIDTH +
+                     ATLAS_BANNER_SPANS[(i + 1) % ATLAS_BANNER_COUNT].width;
+    for (int offset = 2; offset < transition; offset += 2) {
+      frames.push_back(BannerFrame{i, offset});
+    }
+  }
+
+  const size_t frameBytes = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+  const int16_t y = 54;
+  uint64_t gfxNs = 0, stripNs = 0;
+  uint32_t mismatches = 0;
+  for (uint32_t round = 0; round < rounds; round++) {
+    for (size_t f = 0; f < frames.size(); f++) {
+      HostClock::time_point start = HostClock::now();
+      drawBannerGfx(gfx, frames[f], y);
+      gfxNs += hostNs(start, HostClock::now());
+
+      start = HostClock::now();
+      drawBannerStrip(strip.getBuffer(), frames[f], y);
+      stripNs += hostNs(start, HostClock::now());
+
+      mismatches += memcmp(gfx.getBuffer(), strip.getBuffer(), frameBytes) != 0;
+    }
+  }
+
+  double n = rounds * frames.size() > 0 ? static_cast<double>(rounds * frames.size()) : 1.0;
+  fprintf(stderr, "banner bench: %lu rounds of %lu ticker frames (%u messages, strip %lu bytes)\n",
+          static_cast<unsigned long>(rounds), static_cast<unsigned long>(frames.size()),
+          static_cast<unsigned>(ATLAS_BANNER_COUNT), static_cast<unsigned long>(sizeof(ATLAS_BANNER_STRIP)));
+  fprintf(stderr, "  per frame via GFX: %.0f ns, via strip: %.0f ns (%.1fx)\n",
+          gfxNs / n, stripNs / n, stripNs > 0 ? static_cast<double>(gfxNs) / stripNs : 0.0);
+  fprintf(stderr, "  framebuffers %s\n", mismatches == 0 ? "identical" : "DIFFER");
+  return mismatches == 0 ? 0 : 1;
+}
+
+// Synthetic dish titles in the mix the menu feed delivers: German, French
+// and Italian words with umlauts and accents, plus some plain ASCII ones
+std::vector<std::string> makeDishTitles(uint32_t count) {
+  static const char* const dishes[] = {
+    "Älplermagronen", "Zürcher Geschnetzeltes", "Rösti", "Crème brûlée", "Salade niçoise",
+    "Gemüsecurry", "Spätzle", "Käseschnitte", "Würstchen", "Bœuf bourguignon", "Gratin dauphinois",
+    "Risotto ai funghi", "Poulet à la crème", "Pâtes fraîches", "Kürbissuppe", "Chili sin carne",
+    "Schweinsbratwurst", "Fischknusperli", "Penne all'arrabbiata", "Falafel", "Tofu-Bowl",
+  };
+  static const char* const sides[] = {
+    "mit Rösti", "mit Salzkartoffeln", "und Blattsalat", "an Rahmsauce", "mit Gemüse",
+    "mit Zwiebelsauce", "et pommes frites", "con verdure", "mit Preiselbeeren", "und Apfelmus",
+    "mit Pommes frites", "with rice", "Tagesdessert", "– vegan –", "«hausgemacht»", "(€ 2.50 Aufpreis)",
+  };
+  const int dishCount = sizeof(dishes) / sizeof(dishes[0]);
+  const int sideCount = sizeof(sides) / sizeof(sides[0]);
+  std::vector<std::string> titles;
+  uint32_t seed = 12345;
+  for (uint32_t i = 0; i < count; i++) {
+    seed = seed * 1103515245u + 12345u;
+    std::string title = dishes[(seed >> 16) % dishCount];
+    int extra = (seed >> 8) % 4;
+    for (int e = 0; e < extra; e++) {
+      seed = seed * 1103515245u + 12345u;
+      title += " ";
+      title += sides[(seed >> 16) % sideCount];
+    }
+    titles.push_back(title);
+  }
+  // A fixed set of ASCII-only titles for the pixel comparison with GFX
+  titles.push_back("Chili sin carne with rice and sour cream");
+  titles.push_back("Penne all'arrabbiata");
+  titles.push_back("Falafel, hummus, tabouleh & pita bread (vegan)");
+  return titles;
+}
+
+bool isAscii(const std::string& text) {
+  for (size_t i = 0; i < text.size(); i++) {
+    if (static_cast<uint8_t>(text[i]) >= 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The title block as monitor_show_mensa_menu() drew it before the text
+// engine: wrap at 21 bytes and let GFX print each byte as a glyph. Returns
+// whether the title did not fit on the three lines.
+bool drawTitleGfx(Adafruit_SSD1306& gfx, const char* title) {
+  int titleLength = strlen(title);
+  int maxCharsPerLine = 21;
+  int yPos = 26;
+  gfx.setCursor(0, 26);
+  if (titleLength <= maxCharsPerLine) {
+    gfx.println(title);
+    return false;
+  }
+  int lastSpace = 0;
+  int lineStart = 0;
+  for (int i = 0; i < titleLength && yPos < 48; i++) {
+    if (title[i] == ' ') {
+      lastSpace = i;
+    }
+    if (i - lineStart >= maxCharsPerLine || i == titleLength - 1) {
+      int endPos = (i == titleLength - 1) ? i + 1 : lastSpace;
+      if (endPos <= lineStart) endPos = i;
+      gfx.setCursor(0, yPos);
+      gfx.write(title + lineStart, endPos - lineStart);
+      gfx.println();
+      yPos += 8;
+      lineStart = endPos + 1;
+      i = endPos;
+    }
+  }
+  return lineStart < titleLength;
+}
+
+// The title block as monitor_show_mensa_menu() draws it now
+bool drawTitleText(uint8_t* framebuffer, const char* title) {
+  const char* line = title;
+  for (int16_t y = 26; y < 48 && *line != '\0'; y += TEXT_LINE_HEIGHT) {
+    const char* next;
+    size_t length = text_wrap(line, SCREEN_WIDTH, &next);
+    text_draw(framebuffer, 0, y, line, length);
+    line = next;
+  }
+  return *line != '\0';
+}
+
+// Every title of a large synthetic menu through the old byte-wise wrap and
+// GFX print versus text_wrap() and text_draw() with the glyph cache
+int runTextBench(uint32_t count) {
+  native_hal_set_quiet(true);
+  Adafruit_SSD1306 gfx(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+  Adafruit_SSD1306 text(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+  if (!gfx.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS) || !text.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS)) {
+    fprintf(stderr, "text bench: no framebuffer\n");
+    return 1;
+  }
+  gfx.setTextColor(SSD1306_WHITE);
+  gfx.setTextSize(1);
+  std::vector<std::string> titles = makeDishTitles(count);
+  text_reset_cache();
+  // Three lines from y = 26; descenders of the last reach into the separator row
+  const int16_t TITLE_ROWS = 24;
+
+  uint64_t gfxNs = 0, textNs = 0, gfxWidthNs = 0, textWidthNs = 0;
+  uint32_t gfxCut = 0, textCut = 0, asciiTitles = 0, mismatches = 0, widthErrors = 0;
+  size_t bytes = 0;
+  for (size_t t = 0; t < titles.size(); t++) {
+    const char* title = titles[t].c_str();
+    bytes += titles[t].size();
+
+    HostClock::time_point start = HostClock::now();
+    gfx.fillRect(0, 26, SCREEN_WIDTH, TITLE_ROWS, SSD1306_BLACK);
+    gfxCut += drawTitleGfx(gfx, title);
+    gfxNs += hostNs(start, HostClock::now());
+
+    start = HostClock::now();
+    text.fillRect(0, 26, SCREEN_WIDTH, TITLE_ROWS, SSD1306_BLACK);
+    textCut += drawTitleText(text.getBuffer(), title);
+    textNs += hostNs(start, HostClock::now());
+
+    int16_t x1, y1;
+    uint16_t gfxWidth, h;
+    gfx.setTextWrap(false);
+    start = HostClock::now();
+    gfx.getTextBounds(title, 0, 0, &x1, &y1, &gfxWidth, &h);
+    gfxWidthNs += hostNs(start, HostClock::now());
+    gfx.setTextWrap(true);
+    start = HostClock::now();
+    int16_t width = text_width(title);
+    textWidthNs += hostNs(start, HostClock::now());
+    widthErrors += width != text_width(title, titles[t].size()) || (isAscii(titles[t]) && width != gfxWidth);
+
+    // ASCII lines must come out exactly as GFX prints them (on clean
+    // frames: the old wrap could spill past the title block)
+    if (isAscii(titles[t])) {
+      asciiTitles++;
+      gfx.clearDisplay();
+      text.clearDisplay();
+      drawTitleText(text.getBuffer(), title);
+      const char* line = title;
+      for (int16_t y = 26; y < 48 && *line != '\0'; y += 8) {
+        const char* next;
+        size_t length = text_wrap(line, SCREEN_WIDTH, &next);
+        gfx.setCursor(0, y);
+        gfx.write(line, length);
+        line = next;
+      }
+      mismatches += memcmp(gfx.getBuffer(), text.getBuffer(), SCREEN_WIDTH * SCREEN_HEIGHT / 8) != 0;
+    }
+  }
+
+  TextCacheStats cache = text_get_cache_stats();
+  uint32_t lookups = cache.hits + cache.misses;
+  double n = titles.empty() ? 1.0 : static_cast<double>(titles.size());
+  fprintf(stderr, "text bench: %lu titles, %lu bytes of UTF-8 (font %lu bytes, cache %d glyphs)\n",
+          static_cast<unsigned long>(titles.size()), static_cast<unsigned long>(bytes),
+          static_cast<unsigned long>(sizeof(TEXT_FONT)), TEXT_CACHE_SLOTS);
+  fprintf(stderr, "  wrap+draw via GFX bytes: %.0f ns, via text engine: %.0f ns (%.1fx)\n",
+          gfxNs / n, textNs / n, textNs > 0 ? static_cast<double>(gfxNs) / textNs : 0.0);
+  fprintf(stderr, "  width via getTextBounds: %.0f ns, via text_width: %.0f ns (%.1fx)\n",
+          gfxWidthNs / n, textWidthNs / n, textWidthNs > 0 ? static_cast<double>(gfxWidthNs) / textWidthNs : 0.0);
+  fprintf(stderr, "  glyph cache: %lu lookups, %.1f%% hits\n", static_cast<unsigned long>(lookups),
+          lookups > 0 ? 100.0 * cache.hits / lookups : 0.0);
+  fprintf(stderr, "  titles cut after three lines: %lu byte-wise, %lu by pixel width\n",
+          static_cast<unsigned long>(gfxCut), static_cast<unsigned long>(textCut));
+  fprintf(stderr, "  %lu non-ASCII titles printed byte by byte before (one glyph per UTF-8 byte)\n",
+          static_cast<unsigned long>(titles.size() - asciiTitles));
+  fprintf(stderr, "  %lu ASCII titles: framebuffers %s, widths %s\n", static_cast<unsigned long>(asciiTitles),
+          mismatches == 0 ? "identical" : "DIFFER", widthErrors == 0 ? "match" : "DIFFER");
+  return mismatches == 0 && widthErrors == 0 ? 0 : 1;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  uint64_t runSeconds = 60;
+  std::vector<Press> presses;
+  std::vector<Command> commands;
+  bool verbose = false;
+  const char* nvsPath = nullptr;
+  unsigned bounces = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--press") == 0 && i + 1 < argc) {
+      Press press;
+      if (!parsePress(argv[++i], &press)) {
+        fprintf(stderr, "bad --press spec: %s\n", argv[i]);
+        return 2;
+      }
+      presses.push_back(press);
+    } else if (strcmp(argv[i], "--command") == 0 && i + 1 < argc) {
+      Command command;
+      if (!parseCommand(argv[++i], &command)) {
+        fprintf(stderr, "bad --command spec: %s\n", argv[i]);
+        return 2;
+      }
+      commands.push_back(command);
+    } else if (strcmp(argv[i], "--echo") == 0 && i + 1 < argc) {
+      native_hal_set_echo_us(static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+    } else if (strcmp(argv[i], "--menu") == 0 && i + 1 < argc) {
+      if (!native_net_load_body(argv[++i])) {
+        fprintf(stderr, "cannot read --menu file: %s\n", argv[i]);
+        return 2;
+      }
+    } else if (strcmp(argv[i], "--bounce") == 0 && i + 1 < argc) {
+      bounces = static_cast<unsigned>(strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--nvs") == 0 && i + 1 < argc) {
+      nvsPath = argv[++i];
+    } else if (strcmp(argv[i], "--history-bench") == 0 && i + 1 < argc) {
+      return runHistoryBench(static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+    } else if (strcmp(argv[i], "--log-bench") == 0 && i + 1 < argc) {
+      return runLogBench(static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+    } else if (strcmp(argv[i], "--glyph-bench") == 0 && i + 1 < argc) {
+      return runGlyphBench(static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+    } else if (strcmp(argv[i], "--banner-bench") == 0 && i + 1 < argc) {
+      return runBannerBench(static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+    } else if (strcmp(argv[i], "--text-bench") == 0 && i + 1 < argc) {
+      return runTextBench(static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+    } else if (strcmp(argv[i], "--banner-hw") == 0) {
+      monitor_set_banner_hardware_scroll(true);
+    } else if (strcmp(argv[i], "--verbose") == 0) {
+      verbose = true;
+    } else {
+      runSeconds = strtoull(argv[i], nullptr, 10);
+    }
+  }
+
+  std::stable_sort(commands.begin(), commands.end(),
+                   [](const Command& a, const Command& b) { return a.atMs < b.atMs; });
+
+  native_hal_set_quiet(!verbose);
+  native_hal_attach_hcsr04(TRIG_PIN, ECHO_PIN);
+
+  // Report heap relative to what the runner itself holds (e.g. --menu body)
+  native_hal_reset_heap_peak();
+  const uint64_t heapBase = native_hal_heap().currentBytes;
+
+  HostClock::time_point hostStart = HostClock::now();
+  if (nvsPath != nullptr) {
+    native_nvs_load(nvsPath);  // a missing file is a first boot
+  }
+  setup();
+  uint64_t setupHostNs = hostNs(hostStart, HostClock::now());
+  uint64_t setupVirtualUs = native_hal_now_us();
+  NativeHalStats setupStats = native_hal_stats();
+  NativeHeapStats setupHeap = native_hal_heap();
+  native_hal_reset_stats();
+  native_hal_reset_heap_peak();
+
+  const uint64_t loopStartUs = native_hal_now_us();
+  const ButtonStats buttonsBefore = buttons_get_stats();
+  const PowerStats powerBefore = power_get_stats();
+  const DisplayFlushStats flushBefore = monitor_get_flush_stats();
+  const MonitorRenderStats renderBefore = monitor_get_render_stats();
+  for (const Press& press : presses) {
+    uint64_t at = loopStartUs + press.atMs * 1000ULL;
+    uint64_t releaseAt = at + press.holdMs * 1000ULL;
+    native_hal_schedule_pin(press.pin, LOW, at);
+    native_hal_schedule_pin(press.pin, HIGH, releaseAt);
+    // Contact bounce: the level flips back and forth before it settles
+    for (unsigned b = 1; b <= bounces; b++) {
+      native_hal_schedule_pin(press.pin, HIGH, at + b * 300 - 150);
+      native_hal_schedule_pin(press.pin, LOW, at + b * 300);
+      native_hal_schedule_pin(press.pin, LOW, releaseAt + b * 300 - 150);
+      native_hal_schedule_pin(press.pin, HIGH, releaseAt + b * 300);
+    }
+  }
+
+  const uint64_t endUs = loopStartUs + runSeconds * 1000000ULL;
+  uint64_t iterations = 0;
+  uint64_t totalHostNs = 0, maxHostNs = 0;
+  uint64_t maxVirtualUs = 0;
+
+  size_t nextCommand = 0;
+  while (native_hal_now_us() < endUs) {
+    uint64_t virtualBefore = native_hal_now_us();
+    while (nextCommand < commands.size() &&
+           loopStartUs + commands[nextCommand].atMs * 1000ULL <= virtualBefore) {
+      native_hal_serial_feed(commands[nextCommand++].text.c_str());
+    }
+    HostClock::time_point before = HostClock::now();
+    loop();
+    uint64_t elapsedNs = hostNs(before, HostClock::now());
+    uint64_t virtualUs = native_hal_now_us() - virtualBefore;
+
+    totalHostNs += elapsedNs;
+    maxHostNs = std::max(maxHostNs, elapsedNs);
+    maxVirtualUs = std::max(maxVirtualUs, virtualUs);
+    iterations++;
+  }
+
+  const NativeHalStats& stats = native_hal_stats();
+  const NativeHeapStats& heap = native_hal_heap();
+  const DisplayFlushStats flush = monitor_get_flush_stats();
+  const uint64_t virtualUs = native_hal_now_us() - loopStartUs;
+  fflush(stdout);
+
+  fprintf(stderr, "\n=== native run ===\n");
+  fprintf(stderr, "setup: %.1f ms virtual, %.1f us host, %llu I2C bytes\n",
+          setupVirtualUs / 1000.0, setupHostNs / 1000.0,
+          static_cast<unsigned long long>(setupStats.i2cBytes));
+  fprintf(stderr, "  heap: peak %llu bytes, %llu in use after setup, %llu allocations\n",
+          static_cast<unsigned long long>(setupHeap.peakBytes - heapBase),
+          static_cast<unsigned long long>(setupHeap.currentBytes - heapBase),
+          static_cast<unsigned long long>(setupHeap.allocations));
+  if (boot_is_interactive()) {
+    fprintf(stderr, "boot: interactive after %lu ms\n", static_cast<unsigned long>(boot_ms_to_interactive()));
+  } else {
+    fprintf(stderr, "boot: not interactive yet\n");
+  }
+  for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+    const BootPhaseTiming& phase = boot_get_phase(static_cast<BootPhase>(i));
+    if (phase.done) {
+      fprintf(stderr, "  %-8s %8.1f -> %8.1f ms\n", boot_phase_name(static_cast<BootPhase>(i)),
+              phase.startUs / 1000.0, phase.endUs / 1000.0);
+    } else if (phase.started) {
+      fprintf(stderr, "  %-8s %8.1f -> (running)\n", boot_phase_name(static_cast<BootPhase>(i)),
+              phase.startUs / 1000.0);
+    }
+  }
+  fprintf(stderr, "loop: %llu iterations over %.1f s virtual\n",
+          static_cast<unsigned long long>(iterations), virtualUs / 1e6);
+  if (iterations > 0) {
+    fprintf(stderr, "  host per loop: mean %.2f us, max %.2f us\n",
+            totalHostNs / 1000.0 / iterations, maxHostNs / 1000.0);
+    fprintf(stderr, "  virtual per loop: mean %.2f ms, max %.2f ms\n",
+            virtualUs / 1000.0 / iterations, maxVirtualUs / 1000.0);
+  }
+  fprintf(stderr, "  blocked: delay %.1f ms, pulseIn %.1f ms, serial %.1f ms\n",
+          stats.delayUs / 1000.0, stats.pulseInUs / 1000.0, stats.serialBlockedUs / 1000.0);
+  fprintf(stderr, "  I2C: %llu bytes in %llu transactions, bus busy %.1f ms (%.1f bytes/s)\n",
+          static_cast<unsigned long long>(stats.i2cBytes),
+          static_cast<unsigned long long>(stats.i2cTransactions),
+          stats.i2cBusUs / 1000.0,
+          virtualUs > 0 ? stats.i2cBytes * 1e6 / virtualUs : 0.0);
+  const ButtonStats& buttons = buttons_get_stats();
+  fprintf(stderr, "  buttons: %lu presses scheduled, %lu debounced from %lu edges, %lu queue overflows, "
+          "%lu events dropped\n",
+          static_cast<unsigned long>(presses.size()),
+          static_cast<unsigned long>(buttons.presses - buttonsBefore.presses),
+          static_cast<unsigned long>(buttons.edges - buttonsBefore.edges),
+          static_cast<unsigned long>(buttons.overflows - buttonsBefore.overflows),
+          static_cast<unsigned long>(buttons.droppedEvents - buttonsBefore.droppedEvents));
+#if PROFILER_ENABLED
+  const ProfileStats& latency = profiler_get_loop().inputLatency;
+  fprintf(stderr, "  input latency: %lu actions, mean %.2f ms, max %.2f ms\n",
+          static_cast<unsigned long>(latency.count),
+          latency.count > 0 ? latency.totalUs / 1000.0 / latency.count : 0.0,
+          latency.maxUs / 1000.0);
+#else
+  fprintf(stderr, "  input latency: not measured (PROFILER_ENABLED=0)\n");
+#endif
+  const PowerStats& power = power_get_stats();
+  const double activeMs = (power.activeUs - powerBefore.activeUs) / 1000.0;
+  const double waitMs = (power.waitUs - powerBefore.waitUs) / 1000.0;
+  const double sleepMs = (power.lightSleepUs - powerBefore.lightSleepUs) / 1000.0;
+  const double powerMs = activeMs + waitMs + sleepMs;
+  fprintf(stderr, "  power: %.1f wakeups/s, active %.1f ms, wait %.1f ms, light sleep %.1f ms, est %.2f mA\n",
+          (power.wakeups - powerBefore.wakeups) * 1e6 / virtualUs, activeMs, waitMs, sleepMs,
+          powerMs > 0 ? (activeMs * POWER_ACTIVE_MA + waitMs * POWER_WAIT_MA +
+                         sleepMs * POWER_LIGHT_SLEEP_MA) / powerMs : 0.0);
+  const PersistStats& persist = persist_get_stats();
+  fprintf(stderr, "  nvs: %llu writes (%llu bytes), %.1f per day, %lu changes coalesced\n",
+          static_cast<unsigned long long>(stats.nvsWrites),
+          static_cast<unsigned long long>(stats.nvsBytes),
+          stats.nvsWrites * 86400e6 / virtualUs, static_cast<unsigned long>(persist.coalesced));
+  fprintf(stderr, "  log: %lu messages dropped\n", static_cast<unsigned long>(log_dropped_count()));
+  const uint32_t frames = flush.flushes - flushBefore.flushes;
+  fprintf(stderr, "  heap: peak %llu bytes, %llu in use, %llu allocations (%.2f per frame over %lu frames)\n",
+          static_cast<unsigned long long>(heap.peakBytes - heapBase),
+          static_cast<unsigned long long>(heap.currentBytes - heapBase),
+          static_cast<unsigned long long>(heap.allocations),
+          frames > 0 ? static_cast<double>(heap.allocations) / frames : 0.0,
+          static_cast<unsigned long>(frames));
+  const MonitorRenderStats render = monitor_get_render_stats();
+  const uint32_t updates = render.updates - renderBefore.updates;
+  fprintf(stderr, "  raster: %llu framebuffer pixel writes, %.0f per frame\n",
+          static_cast<unsigned long long>(stats.pixelWrites),
+          frames > 0 ? static_cast<double>(stats.pixelWrites) / frames : 0.0);
+  fprintf(stderr, "  screens: %lu updates, %lu composed, %lu redrew %lu widgets, %lu unchanged\n",
+          static_cast<unsigned long>(updates),
+          static_cast<unsigned long>(render.composed - renderBefore.composed),
+          static_cast<unsigned long>(render.rasterized - renderBefore.rasterized),
+          static_cast<unsigned long>(render.widgetsDrawn - renderBefore.widgetsDrawn),
+          static_cast<unsigned long>(updates - (render.rasterized - renderBefore.rasterized)));
+  fprintf(stderr, "  banner: %lu ticker frames drawn, %lu panel RAM writes during a hardware scroll\n",
+          static_cast<unsigned long>(render.bannerDraws - renderBefore.bannerDraws),
+          static_cast<unsigned long>(native_ssd1306_scroll_violations()));
+  fprintf(stderr, "  display (since boot): %lu flushes, %lu pages, %lu bytes vs %lu full-frame (%.1f%%), %lu dropped\n",
+          static_cast<unsigned long>(flush.flushes), static_cast<unsigned long>(flush.pagesSent),
+          static_cast<unsigned long>(flush.bytesSent), static_cast<unsigned long>(flush.fullFrameBytes),
+          flush.fullFrameBytes > 0 ? 100.0 * flush.bytesSent / flush.fullFrameBytes : 0.0,
+          static_cast<unsigned long>(flush.framesDropped));
+
+  if (nvsPath != nullptr && !native_nvs_save(nvsPath)) {
+    fprintf(stderr, "cannot write --nvs file: %s\n", nvsPath);
+    return 1;
+  }
+  return 0;
+}
+
+#endif  // !PIO_UNIT_TESTING
@@ -0,0 +1,222 @@
+// Behavioural model of the SSD1306 controller as seen over I2C. Only the
+// addressing and scroll commands are interpreted; everything else is
+// consumed with the right number of argument bytes and ignored.
+//
+// A horizontal scroll rotates the RAM of its pages by one column every few
+// panel frames of virtual time, as the controller does. RAM writes while a
+// scroll is running are not allowed by the datasheet; they are applied but
+// counted as violations.
+
+#include "native_hal.h"
+
+#include <string.h>
+
+namespace {
+const int PANEL_WIDTH = 128;
+const int PANEL_PAGES = 8;
+
+enum AddressingMode : uint8_t {
+  ADDR_HORIZONTAL = 0,
+  ADDR_VERTICAL = 1,
+  ADDR_PAGE = 2
+};
+
+uint8_t gddram[PANEL_PAGES * PANEL_WIDTH];
+uint8_t mode = ADDR_PAGE;
+uint8_t colStart = 0, colEnd = PANEL_WIDTH - 1, col = 0;
+uint8_t pageStart = 0, pageEnd = PANEL_PAGES - 1, page = 0;
+bool scrolling = false;
+
+// Panel refresh at the clock settings Adafruit_SSD1306::begin() uses; a
+// real part runs anywhere in the oscillator's +/-10 %
+const uint32_t NOMINAL_FRAME_HZ = 105;
+uint64_t frameUs = 1000000 / NOMINAL_FRAME_HZ;
+// Frames per column for each frame-interval code of 0x26/0x27
+const uint16_t SCROLL_FRAMES[8] = {5, 64, 128, 256, 3, 4, 25, 2};
+
+// Horizontal scroll setup (0x26/0x27) and progress since 0x2F
+bool scrollLeft = true;
+uint8_t scrollFirstPage = 0, scrollLastPage = 0;
+uint16_t scrollFrames = 5;
+uint64_t scrollSinceUs = 0;
+uint64_t scrollStepsDone = 0;
+uint32_t scrollViolations = 0;
+
+// Pending multi-byte command
+uint8_t cmd = 0;
+uint8_t args[6];
+int argsWanted = 0;
+int argsHave = 0;
+
+int argumentCount(uint8_t c) {
+  switch (c) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+      return 1;
+    case 0x21: case 0x22: case 0xA3:
+      return 2;
+    case 0x29: case 0x2A:
+      return 5;
+    case 0x26: case 0x27:
+      return 6;
+    default:
+      return 0;
+  }
+}
+
+// Bring the scrolled pages up to the current virtual time
+void applyScroll() {
+  if (!scrolling) {
+    return;
+  }
+  uint64_t due = (native_hal_now_us() - scrollSinceUs) / (frameUs * scrollFrames);
+  uint32_t steps = static_cast<uint32_t>((due - scrollStepsDone) % PANEL_WIDTH);
+  scrollStepsDone = due;
+  if (steps == 0) {
+    return;
+  }
+  uint8_t row[PANEL_WIDTH];
+  for (uint8_t p = scrollFirstPage; p <= scrollLastPage && p < PANEL_PAGES; p++) {
+    uint8_t* ram = gddram + p * PANEL_WIDTH;
+    for (int c = 0; c < PANEL_WIDTH; c++) {
+      int from = scrollLeft ? (c + steps) % PANEL_WIDTH : (c + PANEL_WIDTH - steps) % PANEL_WIDTH;
+      row[c] = ram[from];
+    }
+    memcpy(ram, row, PANEL_WIDTH);
+  }
+}
+
+void executeCommand() {
+  switch (cmd) {
+    case 0x20:
+      mode = args[0] & 0x03;
+      break;
+    case 0x21:
+      colStart = args[0] & 0x7F;
+      colEnd = args[1] & 0x7F;
+      col = colStart;
+      break;
+    case 0x22:
+      pageStart = args[0] & 0x07;
+      pageEnd = args[1] & 0x07;
+      page = pageStart;
+      break;
+    case 0x26: case 0x27:
+      if (scrolling) {
+        scrollViolations++;  // setup must come after 0x2E
+      }
+      scrollLeft = cmd == 0x27;
+      scrollFirstPage = args[1] & 0x07;
+      scrollFrames = SCROLL_FRAMES[args[2] & 0x07];
+      scrollLastPage = args[3] & 0x07;
+      break;
+    case 0x2E:
+      applyScroll();
+      scrolling = false;
+      break;
+    case 0x2F:
+      if (!scrolling) {
+        scrolling = true;
+        scrollSinceUs = native_hal_now_us();
+        scrollStepsDone = 0;
+      }
+      break;
+    default:
+      if (mode == ADDR_PAGE) {
+        if (cmd >= 0xB0 && cmd <= 0xB7) {
+          page = cmd & 0x07;
+        } else if (cmd <= 0x0F) {
+          col = (col & 0xF0) | (cmd & 0x0F);
+        } else if (cmd >= 0x10 && cmd <= 0x1F) {
+          col = ((cmd & 0x07) << 4) | (col & 0x0F);
+        }
+      }
+      break;
+  }
+}
+
+void commandByte(uint8_t b) {
+  if (argsWanted > 0) {
+    args[argsHave++] = b;
+    if (argsHave == argsWanted) {
+      argsWanted = 0;
+      executeCommand();
+    }
+    return;
+  }
+
+  cmd = b;
+  argsHave = 0;
+  argsWanted = argumentCount(b);
+  if (argsWanted == 0) {
+    executeCommand();
+  }
+}
+
+void dataByte(uint8_t b) {
+  if (scrolling) {
+    applyScroll();
+    scrollViolations++;
+  }
+  gddram[page * PANEL_WIDTH + col] = b;
+
+  switch (mode) {
+    case ADDR_HORIZONTAL:
+      if (col >= colEnd) {
+        col = colStart;
+        page = (page >= pageEnd) ? pageStart : page + 1;
+      } else {
+        col++;
+      }
+      break;
+    case ADDR_VERTICAL:
+      if (page >= pageEnd) {
+        page = pageStart;
+        col = (col >= colEnd) ? colStart : col + 1;
+      } else {
+        page++;
+      }
+      break;
+    default:
+      col = (col >= PANEL_WIDTH - 1) ? 0 : col + 1;
+      break;
+  }
+}
+}  // namespace
+
+const uint8_t* native_ssd1306_gddram() {
+  applyScroll();
+  return gddram;
+}
+
+void native_ssd1306_set_frame_hz(uint32_t hz) {
+  applyScroll();
+  // Keep the steps already taken: restart the count at the current time
+  scrollSinceUs = native_hal_now_us();
+  scrollStepsDone = 0;
+  frameUs = 1000000 / (hz == 0 ? NOMINAL_FRAME_HZ : hz);
+}
+
+bool native_ssd1306_scrolling() {
+  return scrolling;
+}
+
+uint32_t native_ssd1306_scroll_violations() {
+  return scrollViolations;
+}
+
+void native_ssd1306_receive(const uint8_t* data, size_t len) {
+  if (len == 0) {
+    return;
+  }
+
+  // Control byte: D/C# (bit 6) selects data vs command for the rest
+  bool isData = (data[0] & 0x40) != 0;
+  for (size_t i = 1; i < len; i++) {
+    if (isData) {
+      dataByte(data[i]);
+    } else {
+      commandByte(data[i]);
+    }
+  }
+}
@@ -0,0 +1,90 @@
+#include "atlas.h"
+
+namespace {
+// Columns of a bitmap at x that land inside the framebuffer
+bool clipColumns(int16_t x, uint8_t width, int16_t* first, int16_t* last) {
+  *first = x < 0 ? -x : 0;
+  *last = x + width > ATLAS_FRAMEBUFFER_WIDTH ? ATLAS_FRAMEBUFFER_WIDTH - x : width;
+  return *first < *last;
+}
+}  // namespace
+
+const AtlasBitmap* atlas_timer_glyph(char c) {
+  const char* chars = ATLAS_TIMER_CHARS;
+  for (int i = 0; chars[i] != '\0'; i++) {
+    if (chars[i] == c) {
+      return &ATLAS_TIMER_GLYPHS[i];
+    }
+  }
+  return nullptr;
+}
+
+void atlas_copy(uint8_t* framebuffer, int16_t x, const AtlasBitmap& bitmap, const uint8_t* pageMasks) {
+  int16_t first, last;
+  if (!clipColumns(x, bitmap.width, &first, &last)) {
+    return;
+  }
+  for (uint8_t page = 0; page < bitmap.pages; page++) {
+    const uint8_t* src = bitmap.data + page * bitmap.width + first;
+    uint8_t* dst = framebuffer + (bitmap.firstPage + page) * ATLAS_FRAMEBUFFER_WIDTH + x + first;
+    uint8_t mask = pageMasks[page];
+    int16_t count = last - first;
+    if (mask == 0xFF) {
+      memcpy(dst, src, count);
+    } else {
+      uint8_t keep = static_cast<uint8_t>(~mask);
+      for (int16_t i = 0; i < count; i++) {
+        dst[i] = static_cast<uint8_t>((dst[i] & keep) | src[i]);
+      }
+    }
+  }
+}
+
+void atlas_draw(uint8_t* framebuffer, int16_t x, const AtlasBitmap& bitmap, bool inverted) {
+  int16_t first, last;
+  if (!clipColumns(x, bitmap.width, &first, &last)) {
+    return;
+  }
+  for (uint8_t page = 0; page < bitmap.pages; page++) {
+    const uint8_t* src = bitmap.data + page * bitmap.width + first;
+    uint8_t* dst = framebuffer + (bitmap.firstPage + page) * ATLAS_FRAMEBUFFER_WIDTH + x + first;
+    int16_t count = last - first;
+    if (inverted) {
+      for (int16_t i = 0; i < count; i++) {
+        dst[i] &= static_cast<uint8_t>(~src[i]);
+      }
+    } else {
+      for (int16_t i = 0; i < count; i++) {
+        dst[i] |= src[i];
+      }
+    }
+  }
+}
+
+bool atlas_draw_timer(uint8_t* framebuffer, int16_t x, const char* text) {
+  for (const char* c = text; *c != '\0'; c++) {
+    if (atlas_timer_glyph(*c) == nullptr) {
+      return false;
+    }
+  }
+  for (const char* c = text; *c != '\0'; c++, x += ATLAS_TIMER_CELL_WIDTH) {
+    atlas_copy(framebuffer, x, *atlas_timer_glyph(*c), ATLAS_TIMER_PAGE_MASKS);
+  }
+  return true;
+}
+
+void atlas_copy_rows(uint8_t* framebuffer, int16_t y, const uint8_t* columns) {
+  uint8_t shift = y & 7;
+  uint8_t* top = framebuffer + (y >> 3) * ATLAS_FRAMEBUFFER_WIDTH;
+  if (shift == 0) {
+    memcpy(top, columns, ATLAS_FRAMEBUFFER_WIDTH);
+    return;
+  }
+  uint8_t* bottom = top + ATLAS_FRAMEBUFFER_WIDTH;
+  uint8_t keepTop = static_cast<uint8_t>(0xFF >> (8 - shift));
+  uint8_t keepBottom = static_cast<uint8_t>(0xFF << shift);
+  for (int16_t x = 0; x < ATLAS_FRAMEBUFFER_WIDTH; x++) {
+    top[x] = static_cast<uint8_t>((top[x] & keepTop) | (columns[x] << shift));
+    bottom[x] = static_cast<uint8_t>((bottom[x] & keepBottom) | (columns[x] >> (8 - shift)));
+  }
+}
@@ -0,0 +1,60 @@
+#include "boot.h"
+#include "log.h"
+
+namespace {
+const char* const PHASE_NAMES[BOOT_PHASE_COUNT] = {
+  "serial", "inputs", "outputs", "display", "sensors", "pomodoro",
+  "led_test", "jingle", "intro", "wifi", "menu"
+};
+
+BootPhaseTiming phases[BOOT_PHASE_COUNT];
+uint32_t interactiveUs = 0;
+bool interactive = false;
+}  // namespace
+
+void boot_phase_begin(BootPhase phase) {
+  BootPhaseTiming& timing = phases[phase];
+  if (timing.started) {
+    return;
+  }
+  timing.startUs = micros();
+  timing.started = true;
+}
+
+void boot_phase_end(BootPhase phase) {
+  BootPhaseTiming& timing = phases[phase];
+  if (!timing.started || timing.done) {
+    return;
+  }
+  timing.endUs = micros();
+  timing.done = true;
+  LOG_I(LOG_APP, "boot: %-8s %6lu ms -> %6lu ms (%lu ms)", PHASE_NAMES[phase],
+        static_cast<unsigned long>(timing.startUs / 1000),
+        static_cast<unsigned long>(timing.endUs / 1000),
+        static_cast<unsigned long>((timing.endUs - timing.startUs) / 1000));
+}
+
+void boot_mark_interactive() {
+  if (interactive) {
+    return;
+  }
+  interactiveUs = micros();
+  interactive = true;
+  LOG_I(LOG_APP, "boot: interactive after %lu ms", static_cast<unsigned long>(interactiveUs / 1000));
+}
+
+bool boot_is_interactive() {
+  return interactive;
+}
+
+uint32_t boot_ms_to_interactive() {
+  return interactive ? interactiveUs / 1000 : 0;
+}
+
+const BootPhaseTiming& boot_get_phase(BootPhase phase) {
+  return phases[phase];
+}
+
+const char* boot_phase_name(BootPhase phase) {
+  return PHASE_NAMES[phase];
+}
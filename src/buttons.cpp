@@ -0,0 +1,281 @@
+#include "buttons.h"
+#include "power.h"
+
+#include <atomic>
+
+namespace {
+const uint32_t DEBOUNCE_US = BUTTON_DEBOUNCE_MS * 1000UL;
+const uint32_t LONG_PRESS_US = BUTTON_LONG_PRESS_MS * 1000UL;
+const uint32_t DOUBLE_CLICK_US = BUTTON_DOUBLE_CLICK_MS * 1000UL;
+
+const uint8_t BUTTON_PINS[BUTTON_COUNT] = {BUTTON1_PIN, BUTTON2_PIN};
+
+static_assert((BUTTON_EDGE_QUEUE_SIZE & (BUTTON_EDGE_QUEUE_SIZE - 1)) == 0,
+              "BUTTON_EDGE_QUEUE_SIZE must be a power of two");
+
+struct Edge {
+  uint32_t timeUs;
+  uint8_t button;
+  uint8_t pressed;
+};
+
+// Single-producer/single-consumer edge queue: both ISRs run on the core
+// that attached them and never nest, so together they are one producer.
+// head/tail run freely and are masked on access.
+Edge edges[BUTTON_EDGE_QUEUE_SIZE];
+std::atomic<uint32_t> edgeHead(0);
+std::atomic<uint32_t> edgeTail(0);
+std::atomic<bool> edgeOverflow(false);
+
+// Levels sampled by buttons_resync(), applied in time order with the queue
+bool resyncPending = false;
+uint32_t resyncAtUs = 0;
+bool resyncLevels[BUTTON_COUNT];
+
+struct Debouncer {
+  bool down;             // debounced state
+  bool raw;              // level of the most recent edge
+  uint32_t lockoutEndUs; // edges before this are bounce
+  bool lockout;
+  uint32_t pressedAtUs;
+  bool longPressSent;
+  uint32_t lastClickUs;  // last PRESS that could start a double click
+  bool clickArmed;
+};
+
+Debouncer debouncers[BUTTON_COUNT];
+
+// Debounced events waiting for buttons_next_event(); loop-only
+const int EVENT_QUEUE_SIZE = 16;
+// Most events one step of the debouncer can emit: an edge settles every
+// button's lockout before it and may start a transition; a resync is an
+// edge per button; the time checks settle and long-press each button
+const int EVENTS_PER_EDGE = BUTTON_COUNT + 1;
+const int EVENTS_PER_RESYNC = EVENTS_PER_EDGE * BUTTON_COUNT;
+const int EVENTS_PER_TIME_CHECK = 2 * BUTTON_COUNT;
+static_assert(EVENT_QUEUE_SIZE >= EVENTS_PER_EDGE + EVENTS_PER_RESYNC &&
+                  EVENT_QUEUE_SIZE >= 2 * EVENTS_PER_RESYNC + EVENTS_PER_TIME_CHECK,
+              "EVENT_QUEUE_SIZE must hold the events of the largest debouncer step");
+ButtonEvent events[EVENT_QUEUE_SIZE];
+int eventHead = 0;
+int eventCount = 0;
+
+ButtonStats stats = {};
+
+// Wrap-safe "a is at or after b" for micros() timestamps
+bool reached(uint32_t a, uint32_t b) {
+  return static_cast<int32_t>(a - b) >= 0;
+}
+
+void IRAM_ATTR pushEdge(ButtonId button) {
+  Edge edge;
+  edge.timeUs = micros();
+  edge.button = button;
+  edge.pressed = (digitalRead(BUTTON_PINS[button]) == LOW);  // active LOW
+
+  uint32_t head = edgeHead.load(std::memory_order_relaxed);
+  if (head - edgeTail.load(std::memory_order_acquire) >= BUTTON_EDGE_QUEUE_SIZE) {
+    edgeOverflow.store(true, std::memory_order_relaxed);
+    return;
+  }
+  edges[head & (BUTTON_EDGE_QUEUE_SIZE - 1)] = edge;
+  edgeHead.store(head + 1, std::memory_order_release);
+  stats.edges++;
+
+  // Cut a power_idle() wait short so the press is handled right away
+  power_wake_from_isr();
+}
+
+void IRAM_ATTR onButton1Edge() {
+  pushEdge(BUTTON_1);
+}
+
+void IRAM_ATTR onButton2Edge() {
+  pushEdge(BUTTON_2);
+}
+
+// True if `count` more events fit in the queue
+bool roomFor(int count) {
+  return eventCount + count <= EVENT_QUEUE_SIZE;
+}
+
+void emit(ButtonEventType type, ButtonId button, uint32_t timeUs) {
+  // process() reserves room before every step, so this is a bug if it
+  // happens; count it rather than write over queued events
+  if (!roomFor(1)) {
+    stats.droppedEvents++;
+    return;
+  }
+  ButtonEvent& event = events[(eventHead + eventCount) % EVENT_QUEUE_SIZE];
+  event.type = type;
+  event.button = button;
+  event.timeUs = timeUs;
+  eventCount++;
+}
+
+// Debounced state change of one button at timeUs
+void transition(ButtonId button, bool down, uint32_t timeUs) {
+  Debouncer& d = debouncers[button];
+  d.down = down;
+  d.lockout = true;
+  d.lockoutEndUs = timeUs + DEBOUNCE_US;
+
+  if (!down) {
+    emit(BUTTON_EVENT_RELEASE, button, timeUs);
+    return;
+  }
+
+  d.pressedAtUs = timeUs;
+  d.longPressSent = false;
+  stats.presses++;
+
+  const Debouncer& other = debouncers[button == BUTTON_1 ? BUTTON_2 : BUTTON_1];
+  if (other.down) {
+    d.clickArmed = false;
+    emit(BUTTON_EVENT_CHORD, button, timeUs);
+  } else if (d.clickArmed && timeUs - d.lastClickUs <= DOUBLE_CLICK_US) {
+    d.clickArmed = false;
+    emit(BUTTON_EVENT_DOUBLE_CLICK, button, timeUs);
+  } else {
+    d.clickArmed = true;
+    d.lastClickUs = timeUs;
+    emit(BUTTON_EVENT_PRESS, button, timeUs);
+  }
+}
+
+// Once the lockout has run out at `nowUs`, adopt the level the pin
+// settled at (a tap shorter than the lockout ends here)
+void settle(ButtonId button, uint32_t nowUs) {
+  Debouncer& d = debouncers[button];
+  if (!d.lockout || !reached(nowUs, d.lockoutEndUs)) {
+    return;
+  }
+  d.lockout = false;
+  if (d.raw != d.down) {
+    transition(button, d.raw, d.lockoutEndUs);
+  }
+}
+
+void applyEdge(const Edge& edge) {
+  ButtonId button = static_cast<ButtonId>(edge.button);
+  Debouncer& d = debouncers[button];
+  // Both buttons, in case loop() was blocked: a tap of the other button
+  // that ended before this edge must not still count as held (a chord)
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    settle(static_cast<ButtonId>(i), edge.timeUs);
+  }
+  d.raw = edge.pressed;
+  if (!d.lockout && d.raw != d.down) {
+    transition(button, d.raw, edge.timeUs);
+  }
+}
+
+// Edges were lost or went unwatched: take the given levels as the truth
+void resync(uint32_t atUs, const bool* pressed) {
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    Edge edge;
+    edge.timeUs = atUs;
+    edge.button = static_cast<uint8_t>(i);
+    edge.pressed = pressed[i];
+    applyEdge(edge);
+  }
+}
+
+void readLevels(bool* pressed) {
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    pressed[i] = (digitalRead(BUTTON_PINS[i]) == LOW);
+  }
+}
+
+void applyPendingResync() {
+  if (resyncPending) {
+    resyncPending = false;
+    resync(resyncAtUs, resyncLevels);
+  }
+}
+
+void checkLongPress(ButtonId button, uint32_t nowUs) {
+  Debouncer& d = debouncers[button];
+  if (d.down && !d.longPressSent && reached(nowUs, d.pressedAtUs + LONG_PRESS_US)) {
+    d.longPressSent = true;
+    emit(BUTTON_EVENT_LONG_PRESS, button, d.pressedAtUs + LONG_PRESS_US);
+  }
+}
+
+// Feed queued edges to the debouncers while there is room for the events
+// they may produce, a pending resync that goes first included; whatever
+// does not fit stays queued for the next call
+void process() {
+  uint32_t tail = edgeTail.load(std::memory_order_relaxed);
+  while (roomFor(EVENTS_PER_EDGE + (resyncPending ? EVENTS_PER_RESYNC : 0))) {
+    if (tail == edgeHead.load(std::memory_order_acquire)) {
+      break;
+    }
+    Edge edge = edges[tail & (BUTTON_EDGE_QUEUE_SIZE - 1)];
+    edgeTail.store(++tail, std::memory_order_release);
+    if (resyncPending && !reached(resyncAtUs, edge.timeUs)) {
+      applyPendingResync();
+    }
+    applyEdge(edge);
+  }
+
+  if (tail != edgeHead.load(std::memory_order_acquire)) {
+    return;  // more edges pending; time-based checks wait until they are in
+  }
+  // The rest may add a resync from buttons_resync(), one from an edge
+  // overflow and the time checks; they keep until all of that fits
+  if (!roomFor(2 * EVENTS_PER_RESYNC + EVENTS_PER_TIME_CHECK)) {
+    return;
+  }
+
+  applyPendingResync();
+
+  uint32_t nowUs = micros();
+  if (edgeOverflow.exchange(false, std::memory_order_relaxed)) {
+    stats.overflows++;
+    bool pressed[BUTTON_COUNT];
+    readLevels(pressed);
+    resync(nowUs, pressed);
+  }
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    settle(static_cast<ButtonId>(i), nowUs);
+    checkLongPress(static_cast<ButtonId>(i), nowUs);
+  }
+}
+}  // namespace
+
+void buttons_init() {
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    pinMode(BUTTON_PINS[i], INPUT_PULLUP);
+    Debouncer& d = debouncers[i];
+    d = Debouncer{};
+    d.down = d.raw = (digitalRead(BUTTON_PINS[i]) == LOW);
+  }
+  attachInterrupt(digitalPinToInterrupt(BUTTON1_PIN), onButton1Edge, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(BUTTON2_PIN), onButton2Edge, CHANGE);
+}
+
+bool buttons_next_event(ButtonEvent* event) {
+  if (eventCount == 0) {
+    process();
+  }
+  if (eventCount == 0) {
+    return false;
+  }
+  *event = events[eventHead];
+  eventHead = (eventHead + 1) % EVENT_QUEUE_SIZE;
+  eventCount--;
+  return true;
+}
+
+void buttons_resync() {
+  // Sample now, before a short press is over; the debouncer applies the
+  // levels on its next run, after any edges queued before this moment
+  readLevels(resyncLevels);
+  resyncAtUs = micros();
+  resyncPending = true;
+}
+
+const ButtonStats& buttons_get_stats() {
+  return stats;
+}
@@ -2,6 +2,12 @@
 #include "buzzer.h"
 #include "lights.h"
 
+#if defined(ESP32)
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
 namespace {
 // Default buzzer pin
 uint8_t buzzerPin = 13;
@@ -62,53 +68,208 @@ constexpr ToneStep turnOnTone[] = {
     {NOTE_G5, 220, 120},
 };
 
-template <size_t N>
-void playSequence(const ToneStep (&steps)[N], LightColor lightColor = LightColor::NONE) {
-  bool toggleState = false;
+// A melody is either a table of ToneSteps or a pair of note/tempo arrays in
+// the classic "1000 / tempo" notation used by the Mario themes.
+struct Melody {
+  const ToneStep* steps;
+  const int* notes;
+  const int* tempo;
+  size_t count;
+  LightColor lightColor;
+};
+
+// Sequencer state. On ESP32 it is advanced from an esp_timer callback and
+// shared with loop(), so every access goes through sequencerLock.
+Melody current = {nullptr, nullptr, nullptr, 0, LightColor::NONE};
+size_t stepIndex = 0;
+bool inPause = false;
+bool toggleState = false;
+volatile bool playing = false;
+// Nominal time of the next step boundary; steps are scheduled against it
+// rather than against "now" so callback latency does not stretch a song.
+uint64_t nextEventUs = 0;
+
+#if defined(ESP32)
+esp_timer_handle_t stepTimer = nullptr;
+SemaphoreHandle_t sequencerLock = nullptr;
+
+void lockSequencer() {
+  xSemaphoreTake(sequencerLock, portMAX_DELAY);
+}
+
+void unlockSequencer() {
+  xSemaphoreGive(sequencerLock);
+}
+
+uint64_t nowMicros() {
+  return static_cast<uint64_t>(esp_timer_get_time());
+}
+
+void startOutput(int frequency) {
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+  ledcWriteTone(buzzerPin, frequency);
+#else
+  ledcWriteTone(BUZZER_LEDC_CHANNEL, frequency);
+#endif
+}
+
+void stopOutput() {
+  startOutput(0);
+}
+#else
+void lockSequencer() {}
+void unlockSequencer() {}
+
+uint64_t nowMicros() {
+  // Extend the 32-bit micros() counter; buzzer_update() runs every loop
+  static uint32_t lastMicros = 0;
+  static uint64_t wrapBase = 0;
+  uint32_t now = static_cast<uint32_t>(micros());
+  if (now < lastMicros) {
+    wrapBase += (1ULL << 32);
+  }
+  lastMicros = now;
+  return wrapBase + now;
+}
 
-  for (const auto& step : steps) {
-    // Turn on lights based on color
-    switch (lightColor) {
-      case LightColor::GREEN:
+void startOutput(int frequency) {
+  tone(buzzerPin, frequency);
+}
+
+void stopOutput() {
+  noTone(buzzerPin);
+}
+#endif
+
+void stepAt(size_t index, int* frequency, int* durationMs, int* pauseMs) {
+  if (current.steps != nullptr) {
+    *frequency = current.steps[index].frequency;
+    *durationMs = current.steps[index].durationMs;
+    *pauseMs = current.steps[index].pauseMs;
+  } else {
+    int noteDuration = 1000 / current.tempo[index];  // e.g., 1000/4 = quarter
+    *frequency = current.notes[index];
+    *durationMs = noteDuration;
+    *pauseMs = (int)(noteDuration * 0.30);          // small gap
+  }
+}
+
+void showStepLights() {
+  switch (current.lightColor) {
+    case LightColor::GREEN:
+      light_green_on();
+      break;
+    case LightColor::RED:
+      light_red_on();
+      break;
+    case LightColor::BOTH:
+      light_both_on();
+      break;
+    case LightColor::ALTERNATE:
+      if (toggleState) {
         light_green_on();
-        break;
-      case LightColor::RED:
+        light_red_off();
+      } else {
         light_red_on();
-        break;
-      case LightColor::BOTH:
-        light_both_on();
-        break;
-      case LightColor::ALTERNATE:
-        if (toggleState) {
-          light_green_on();
-          light_red_off();
-        } else {
-          light_red_on();
-          light_green_off();
-        }
-        toggleState = !toggleState;
-        break;
-      case LightColor::NONE:
-      default:
-        break;
-    }
+        light_green_off();
+      }
+      toggleState = !toggleState;
+      break;
+    case LightColor::NONE:
+    default:
+      break;
+  }
+}
 
-    tone(buzzerPin, step.frequency, step.durationMs);
-    delay(step.durationMs);
-    noTone(buzzerPin);
+void finishPlayback() {
+  stopOutput();
+  if (current.lightColor != LightColor::NONE) {
+    light_both_off();
+  }
+  playing = false;
+}
 
-    // Turn off lights
-    if (lightColor != LightColor::NONE) {
-      light_both_off();
+// Runs every step boundary whose time has come and leaves nextEventUs at
+// the following one. Returns false once the melody is over.
+bool advanceSequencer(uint64_t now) {
+  while (playing && now >= nextEventUs) {
+    int frequency, durationMs, pauseMs;
+
+    if (!inPause) {
+      // End of a note: silence it and start its trailing gap
+      stepAt(stepIndex, &frequency, &durationMs, &pauseMs);
+      stopOutput();
+      if (current.lightColor != LightColor::NONE) {
+        light_both_off();
+      }
+      inPause = true;
+      nextEventUs += static_cast<uint64_t>(pauseMs) * 1000ULL;
+      stepIndex++;
+      continue;
     }
 
-    if (step.pauseMs > 0) {
-      delay(step.pauseMs);
+    if (stepIndex >= current.count) {
+      finishPlayback();
+      return false;
     }
+
+    // Start of the next note; a zero frequency is a rest
+    stepAt(stepIndex, &frequency, &durationMs, &pauseMs);
+    showStepLights();
+    if (frequency > 0) {
+      startOutput(frequency);
+    }
+    inPause = false;
+    nextEventUs += static_cast<uint64_t>(durationMs) * 1000ULL;
   }
+  return playing;
+}
 
-  // Ensure lights are off at the end
-  light_both_off();
+#if defined(ESP32)
+void scheduleNextStep(uint64_t now) {
+  uint64_t waitUs = nextEventUs > now ? nextEventUs - now : 1;
+  esp_timer_start_once(stepTimer, waitUs);
+}
+
+void onStepTimer(void* arg) {
+  (void)arg;
+  lockSequencer();
+  uint64_t now = nowMicros();
+  if (advanceSequencer(now)) {
+    scheduleNextStep(now);
+  }
+  unlockSequencer();
+}
+#endif
+
+void startMelody(const Melody& melody) {
+  lockSequencer();
+#if defined(ESP32)
+  esp_timer_stop(stepTimer);
+#endif
+  if (playing) {
+    finishPlayback();
+  }
+
+  current = melody;
+  stepIndex = 0;
+  toggleState = false;
+  playing = melody.count > 0;
+  // Enter as if a zero-length gap just ended so the first note starts now
+  inPause = true;
+  uint64_t now = nowMicros();
+  nextEventUs = now;
+  if (advanceSequencer(now)) {
+#if defined(ESP32)
+    scheduleNextStep(now);
+#endif
+  }
+  unlockSequencer();
+}
+
+template <size_t N>
+void playSequence(const ToneStep (&steps)[N], LightColor lightColor = LightColor::NONE) {
+  startMelody(Melody{steps, nullptr, nullptr, N, lightColor});
 }
 }  // namespace
 
@@ -116,7 +277,47 @@ void playSequence(const ToneStep (&steps)[N], LightColor lightColor = LightColor
 void buzzer_init(uint8_t pin) {
   buzzerPin = pin;
   pinMode(buzzerPin, OUTPUT);
-  noTone(buzzerPin);
+#if defined(ESP32)
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+  ledcAttach(buzzerPin, 2000, 10);
+#else
+  ledcSetup(BUZZER_LEDC_CHANNEL, 2000, 10);
+  ledcAttachPin(buzzerPin, BUZZER_LEDC_CHANNEL);
+#endif
+  if (sequencerLock == nullptr) {
+    sequencerLock = xSemaphoreCreateMutex();
+  }
+  if (stepTimer == nullptr) {
+    esp_timer_create_args_t args = {};
+    args.callback = onStepTimer;
+    args.name = "buzzer";
+    esp_timer_create(&args, &stepTimer);
+  }
+#endif
+  stopOutput();
+}
+
+void buzzer_update() {
+#if !defined(ESP32)
+  lockSequencer();
+  advanceSequencer(nowMicros());
+  unlockSequencer();
+#endif
+}
+
+bool buzzer_is_playing() {
+  return playing;
+}
+
+void buzzer_stop() {
+  lockSequencer();
+#if defined(ESP32)
+  esp_timer_stop(stepTimer);
+#endif
+  if (playing) {
+    finishPlayback();
+  }
+  unlockSequencer();
 }
 
 void buzzer_play_sound_happy1() {
@@ -318,42 +519,13 @@ int underworld_tempo[] = {
   3, 3, 3
 };
 
-// ===== Utility: safe buzz (handles frequency == 0) =====
-void buzzer_play_music_with_light(int targetPin, long frequency, long lengthMs) {
-  if (lengthMs <= 0) return;
-
-  if (frequency <= 0) {
-    // Rest: just wait
-    delay(lengthMs);
-    return;
-  }
-
-  long halfPeriodUs = 1000000L / frequency / 2L;   // microseconds
-  long cycles = (frequency * lengthMs) / 1000L;    // total cycles
-
-  for (long i = 0; i < cycles; i++) {
-    digitalWrite(targetPin, HIGH);
-    delayMicroseconds(halfPeriodUs);
-    digitalWrite(targetPin, LOW);
-    delayMicroseconds(halfPeriodUs);
-  }
-}
-
 // ===== Play functions =====
 void buzzer_music_mario_play_overworld() {
-  int size = sizeof(marioMelody) / sizeof(int);
-  for (int i = 0; i < size; i++) {
-    int noteDuration = 1000 / marioTempo[i];      // e.g., 1000/4 = quarter
-    buzzer_play_music_with_light(buzzerPin, marioMelody[i], noteDuration);
-    delay((int)(noteDuration * 0.30));            // small gap
-  }
+  startMelody(Melody{nullptr, marioMelody, marioTempo,
+                     sizeof(marioMelody) / sizeof(int), LightColor::NONE});
 }
 
 void buzzer_music_mario_play_underworld() {
-  int size = sizeof(underworld_melody) / sizeof(int);
-  for (int i = 0; i < size; i++) {
-    int noteDuration = 1000 / underworld_tempo[i];
-    buzzer_play_music_with_light(buzzerPin, underworld_melody[i], noteDuration);
-    delay((int)(noteDuration * 0.30));
-  }
+  startMelody(Melody{nullptr, underworld_melody, underworld_tempo,
+                     sizeof(underworld_melody) / sizeof(int), LightColor::NONE});
 }
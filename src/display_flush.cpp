@@ -0,0 +1,344 @@
+#include "display_flush.h"
+
+// Largest I2C write the Wire driver accepts in one transaction
+#if defined(I2C_BUFFER_LENGTH)
+static const uint16_t WIRE_MAX = (I2C_BUFFER_LENGTH < 256) ? I2C_BUFFER_LENGTH : 256;
+#else
+static const uint16_t WIRE_MAX = 32;
+#endif
+
+// Bytes a transfer of `count` payload bytes costs when every transaction is
+// prefixed by the address byte and a control byte
+static uint32_t wireCost(uint32_t count) {
+  uint32_t perTransaction = WIRE_MAX - 1;
+  uint32_t transactions = (count + perTransaction - 1) / perTransaction;
+  return count + transactions * 2;
+}
+
+#if defined(ESP32)
+static const uint32_t FLUSH_TASK_STACK = 3072;
+static const UBaseType_t FLUSH_TASK_PRIORITY = 2;
+#endif
+
+DirtyPageSSD1306::DirtyPageSSD1306(uint8_t w, uint8_t h, TwoWire* twi, int8_t rst_pin)
+    : Adafruit_SSD1306(w, h, twi, rst_pin), shadow(nullptr), shadowValid(false),
+      invalidPages(0), scrollPages(0), asyncEnabled(false), flushStats()
+#if defined(ESP32)
+      , handoff(nullptr), sending(nullptr), framePending(false), flushBusy(false),
+      frameLock(nullptr), flushTaskHandle(nullptr)
+#endif
+{}
+
+DirtyPageSSD1306::~DirtyPageSSD1306() {
+#if defined(ESP32)
+  if (flushTaskHandle != nullptr) {
+    vTaskDelete(flushTaskHandle);
+  }
+  if (frameLock != nullptr) {
+    vSemaphoreDelete(frameLock);
+  }
+  free(handoff);
+  free(sending);
+#endif
+  free(shadow);
+}
+
+bool DirtyPageSSD1306::begin(uint8_t switchvcc, uint8_t i2caddr) {
+  if (!Adafruit_SSD1306::begin(switchvcc, i2caddr)) {
+    return false;
+  }
+
+  if (shadow == nullptr) {
+    shadow = static_cast<uint8_t*>(malloc(WIDTH * ((HEIGHT + 7) / 8)));
+    if (shadow == nullptr) {
+      return false;
+    }
+  }
+
+  invalidate();
+  return true;
+}
+
+void DirtyPageSSD1306::invalidate() {
+  // Applied by the next flushFrame(), which may run on the flush task
+  invalidPages.store(0xFF);
+}
+
+void DirtyPageSSD1306::invalidatePages(uint8_t first, uint8_t last) {
+  uint8_t mask = 0;
+  for (uint8_t page = first; page <= last && page < 8; page++) {
+    mask |= static_cast<uint8_t>(1 << page);
+  }
+  invalidPages.fetch_or(mask);
+}
+
+void DirtyPageSSD1306::startScrollLeft(uint8_t first, uint8_t last, uint8_t interval) {
+  // The scroll must see the frame it is meant to move
+  waitForFlush();
+  // A new scroll setup is only allowed while scrolling is off
+  const uint8_t commands[] = {
+    SSD1306_DEACTIVATE_SCROLL,
+    SSD1306_LEFT_HORIZONTAL_SCROLL, 0x00, first, interval, last, 0x00, 0xFF,
+    SSD1306_ACTIVATE_SCROLL
+  };
+  wire->setClock(wireClk);
+  countTraffic(0, sendCommands(commands, sizeof(commands)));
+  wire->setClock(restoreClk);
+  if (scrollPages != 0) {
+    invalidPages.fetch_or(scrollPages);
+  }
+  scrollPages = 0;
+  for (uint8_t page = first; page <= last && page < 8; page++) {
+    scrollPages |= static_cast<uint8_t>(1 << page);
+  }
+}
+
+void DirtyPageSSD1306::stopScroll() {
+  if (scrollPages == 0) {
+    return;
+  }
+  waitForFlush();
+  const uint8_t commands[] = {SSD1306_DEACTIVATE_SCROLL};
+  wire->setClock(wireClk);
+  countTraffic(0, sendCommands(commands, sizeof(commands)));
+  wire->setClock(restoreClk);
+  // The scroll moved the RAM under those pages; the shadow no longer matches
+  invalidPages.fetch_or(scrollPages);
+  scrollPages = 0;
+}
+
+// Returns the bytes put on the wire
+uint32_t DirtyPageSSD1306::sendCommands(const uint8_t* commands, uint8_t count) {
+  wire->beginTransmission(i2caddr);
+  wire->write(static_cast<uint8_t>(0x00));
+  wire->write(commands, count);
+  wire->endTransmission();
+  return count + 2;
+}
+
+uint32_t DirtyPageSSD1306::sendData(const uint8_t* data, uint16_t count) {
+  uint32_t sent = 0;
+  while (count > 0) {
+    uint16_t chunk = count < WIRE_MAX - 1 ? count : WIRE_MAX - 1;
+    wire->beginTransmission(i2caddr);
+    wire->write(static_cast<uint8_t>(0x40));
+    wire->write(data, chunk);
+    wire->endTransmission();
+    sent += chunk + 2;
+    data += chunk;
+    count -= chunk;
+  }
+  return sent;
+}
+
+void DirtyPageSSD1306::countTraffic(uint32_t pages, uint32_t bytes) {
+  lockFrame();
+  flushStats.pagesSent += pages;
+  flushStats.bytesSent += bytes;
+  unlockFrame();
+}
+
+DisplayFlushStats DirtyPageSSD1306::stats() const {
+  lockFrame();
+  DisplayFlushStats copy = flushStats;
+  unlockFrame();
+  return copy;
+}
+
+// frameLock guards the handoff, the task's flags and the counters. Before
+// the task exists everything runs on one core and there is nothing to lock.
+void DirtyPageSSD1306::lockFrame() const {
+#if defined(ESP32)
+  if (frameLock != nullptr) {
+    xSemaphoreTake(frameLock, portMAX_DELAY);
+  }
+#endif
+}
+
+void DirtyPageSSD1306::unlockFrame() const {
+#if defined(ESP32)
+  if (frameLock != nullptr) {
+    xSemaphoreGive(frameLock);
+  }
+#endif
+}
+
+void DirtyPageSSD1306::display() {
+  const uint8_t pages = (HEIGHT + 7) / 8;
+
+  // No RAM writes while the controller scrolls
+  stopScroll();
+
+  lockFrame();
+  flushStats.flushes++;
+  // Reference: page window + column window + the whole buffer
+  flushStats.fullFrameBytes += (5 + 2) + (1 + 2) + wireCost(WIDTH * pages);
+  unlockFrame();
+
+  if (shadow == nullptr) {
+    Adafruit_SSD1306::display();
+    return;
+  }
+
+#if defined(ESP32)
+  if (asyncEnabled) {
+    const size_t frameSize = WIDTH * pages;
+    xSemaphoreTake(frameLock, portMAX_DELAY);
+    // Identical to what is already queued (e.g. RoboEyes flushing right
+    // before the monitor does): nothing new to send
+    if (invalidPages.load() == 0 && memcmp(handoff, buffer, frameSize) == 0) {
+      xSemaphoreGive(frameLock);
+      return;
+    }
+    if (framePending) {
+      flushStats.framesDropped++;
+    }
+    memcpy(handoff, buffer, frameSize);
+    framePending = true;
+    xSemaphoreGive(frameLock);
+    xTaskNotifyGive(flushTaskHandle);
+    return;
+  }
+#endif
+
+  flushFrame(buffer);
+}
+
+// Send the parts of `frame` that differ from the shadow
+void DirtyPageSSD1306::flushFrame(const uint8_t* frame) {
+  const uint8_t pages = (HEIGHT + 7) / 8;
+
+  // Taken in one step, so an invalidation from loop() during this flush
+  // stays set for the next one
+  uint8_t stale = invalidPages.exchange(0);
+  if (!shadowValid) {
+    stale = 0xFF;
+  }
+  uint32_t pagesSent = 0;
+  uint32_t bytesSent = 0;
+
+  wire->setClock(wireClk);
+
+  for (uint8_t page = 0; page < pages; page++) {
+    const uint8_t* row = frame + page * WIDTH;
+    uint8_t* shadowRow = shadow + page * WIDTH;
+
+    int16_t first = 0;
+    int16_t last = WIDTH - 1;
+    if (!(stale & (1 << page))) {
+      while (first < WIDTH && row[first] == shadowRow[first]) {
+        first++;
+      }
+      if (first == WIDTH) {
+        continue;  // page unchanged
+      }
+      while (last > first && row[last] == shadowRow[last]) {
+        last--;
+      }
+    }
+
+    const uint8_t window[] = {
+      SSD1306_PAGEADDR, page, page,
+      SSD1306_COLUMNADDR, static_cast<uint8_t>(first), static_cast<uint8_t>(last)
+    };
+    bytesSent += sendCommands(window, sizeof(window));
+    bytesSent += sendData(row + first, last - first + 1);
+
+    memcpy(shadowRow + first, row + first, last - first + 1);
+    pagesSent++;
+  }
+
+  shadowValid = true;
+  wire->setClock(restoreClk);
+  countTraffic(pagesSent, bytesSent);
+}
+
+bool DirtyPageSSD1306::beginAsync() {
+#if defined(ESP32)
+  if (shadow == nullptr) {
+    return false;
+  }
+
+  if (flushTaskHandle == nullptr) {
+    const size_t frameSize = WIDTH * ((HEIGHT + 7) / 8);
+    handoff = static_cast<uint8_t*>(malloc(frameSize));
+    sending = static_cast<uint8_t*>(malloc(frameSize));
+    frameLock = xSemaphoreCreateMutex();
+    if (handoff == nullptr || sending == nullptr || frameLock == nullptr) {
+      return false;
+    }
+    memcpy(handoff, buffer, frameSize);
+
+    // Run on whichever core loop() is not using
+    BaseType_t core = (xPortGetCoreID() == 0) ? 1 : 0;
+    if (xTaskCreatePinnedToCore(flushTask, "ssd1306_flush", FLUSH_TASK_STACK, this,
+                                FLUSH_TASK_PRIORITY, &flushTaskHandle, core) != pdPASS) {
+      flushTaskHandle = nullptr;
+      return false;
+    }
+  }
+
+  asyncEnabled = true;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void DirtyPageSSD1306::setAsync(bool enabled) {
+#if defined(ESP32)
+  if (enabled) {
+    beginAsync();
+    return;
+  }
+  // Let the task finish so the two paths never share the bus
+  waitForFlush();
+#else
+  (void)enabled;
+#endif
+  asyncEnabled = false;
+}
+
+void DirtyPageSSD1306::waitForFlush() {
+#if defined(ESP32)
+  // Both flags under the lock: the task marks itself busy before it clears
+  // the pending flag, so there is no moment where both read false while
+  // a frame is still on its way to the bus
+  while (asyncEnabled) {
+    xSemaphoreTake(frameLock, portMAX_DELAY);
+    bool idle = !framePending && !flushBusy;
+    xSemaphoreGive(frameLock);
+    if (idle) {
+      return;
+    }
+    delay(1);
+  }
+#endif
+}
+
+#if defined(ESP32)
+void DirtyPageSSD1306::flushTask(void* arg) {
+  DirtyPageSSD1306* self = static_cast<DirtyPageSSD1306*>(arg);
+  const size_t frameSize = self->WIDTH * ((self->HEIGHT + 7) / 8);
+
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    xSemaphoreTake(self->frameLock, portMAX_DELAY);
+    if (!self->framePending) {
+      xSemaphoreGive(self->frameLock);
+      continue;
+    }
+    memcpy(self->sending, self->handoff, frameSize);
+    self->flushBusy = true;
+    self->framePending = false;
+    xSemaphoreGive(self->frameLock);
+
+    self->flushFrame(self->sending);
+
+    xSemaphoreTake(self->frameLock, portMAX_DELAY);
+    self->flushBusy = false;
+    xSemaphoreGive(self->frameLock);
+  }
+}
+#endif
@@ -0,0 +1,73 @@
+#include "format.h"
+
+namespace {
+// "00" to "99", two characters per entry
+constexpr char DIGIT_PAIRS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+constexpr const char* STATE_NAMES[] = {
+  "Idle", "Work", "Short Break", "Long Break", "Paused"
+};
+
+static_assert(sizeof(STATE_NAMES) / sizeof(STATE_NAMES[0]) == POMODORO_PAUSED + 1,
+              "one name per PomodoroState");
+
+// Copies `len` characters into out, truncating to fit, and terminates it
+size_t emit(char* out, size_t size, const char* text, size_t len) {
+  if (size == 0) {
+    return 0;
+  }
+  if (len > size - 1) {
+    len = size - 1;
+  }
+  memcpy(out, text, len);
+  out[len] = '\0';
+  return len;
+}
+
+void putPair(char* at, unsigned value) {
+  at[0] = DIGIT_PAIRS[value * 2];
+  at[1] = DIGIT_PAIRS[value * 2 + 1];
+}
+}  // namespace
+
+size_t format_time(char* out, size_t size, unsigned long seconds) {
+  unsigned long minutes = seconds / 60;
+  unsigned secs = static_cast<unsigned>(seconds % 60);
+  if (minutes > 9999) {
+    minutes = 9999;
+    secs = 59;
+  }
+
+  char text[FORMAT_TIME_SIZE];
+  size_t len = 0;
+  if (minutes >= 100) {
+    unsigned high = static_cast<unsigned>(minutes / 100);
+    if (high >= 10) {
+      putPair(text, high);
+      len = 2;
+    } else {
+      text[len++] = static_cast<char>('0' + high);
+    }
+    minutes %= 100;
+  }
+  putPair(text + len, static_cast<unsigned>(minutes));
+  len += 2;
+  text[len++] = ':';
+  putPair(text + len, secs);
+  len += 2;
+  return emit(out, size, text, len);
+}
+
+const char* format_state_name(PomodoroState state) {
+  return static_cast<unsigned>(state) <= POMODORO_PAUSED ? STATE_NAMES[state] : "Unknown";
+}
@@ -1,6 +1,7 @@
 #include "gambling.h"
 #include "monitor.h"
 #include "buzzer.h"
+#include "log.h"
 
 #if defined(ESP32)
 #include <esp_timer.h>
@@ -12,6 +13,12 @@ const unsigned long GAMBLING_RESULT_DISPLAY_MS = 1500;
 namespace {
 bool active = false;
 bool awaitingChoice = false;
+
+// The result stays on screen for a while; loop() keeps running meanwhile
+bool showingResult = false;
+unsigned long resultShownAt = 0;
+GamblingChoice resultChoice = GamblingChoice::Red;
+bool resultWin = false;
 }
 
 void gambling_init() {
@@ -56,23 +63,52 @@ bool gambling_register_choice(GamblingChoice choice, bool* winOut) {
 void gambling_reset() {
   active = false;
   awaitingChoice = false;
+  showingResult = false;
 }
 
 void gambling_handle_result(GamblingChoice choice, bool win) {
-  Serial.print("\n=== Gambling Choice: ");
-  Serial.print(choice == GamblingChoice::Red ? "RED" : "BLACK");
-  Serial.println(" ===");
+  LOG_I(LOG_GAMBLING, "=== Gambling Choice: %s ===", choice == GamblingChoice::Red ? "RED" : "BLACK");
 
+  resultChoice = choice;
+  resultWin = win;
   monitor_gambling_show_result(choice, win);
 
   if (win) {
-    Serial.println("Result: WIN! Mario theme incoming...");
+    LOG_I(LOG_GAMBLING, "Result: WIN! Mario theme incoming...");
     buzzer_music_mario_play_overworld();
   } else {
-    Serial.println("Result: LOSS. Better luck next time.");
+    LOG_I(LOG_GAMBLING, "Result: LOSS. Better luck next time.");
     buzzer_play_sound_sad1();
   }
 
-  delay(GAMBLING_RESULT_DISPLAY_MS);
+  showingResult = true;
+  resultShownAt = millis();
+}
+
+bool gambling_showing_result() {
+  return showingResult;
+}
+
+unsigned long gambling_ms_until_result_end(unsigned long now) {
+  if (!showingResult) {
+    return 0;
+  }
+  unsigned long shown = now - resultShownAt;
+  return shown < GAMBLING_RESULT_DISPLAY_MS ? GAMBLING_RESULT_DISPLAY_MS - shown : 0;
+}
+
+bool gambling_update(unsigned long now) {
+  if (!showingResult || now - resultShownAt < GAMBLING_RESULT_DISPLAY_MS) {
+    return false;
+  }
   gambling_reset();
+  return true;
+}
+
+void gambling_show_screen() {
+  if (showingResult) {
+    monitor_gambling_show_result(resultChoice, resultWin);
+  } else {
+    monitor_gambling_show_intro();
+  }
 }
@@ -0,0 +1,392 @@
+#include "history.h"
+#include "log.h"
+
+#if defined(ESP32)
+#include <esp_partition.h>
+#include <esp_timer.h>
+#endif
+
+namespace {
+// Data partition subtype of "history" in partitions.csv
+const uint8_t PARTITION_SUBTYPE = 0x40;
+
+const uint32_t SECTOR_MAGIC = 0x31545348;  // "HST1"
+const uint32_t SLOTS_PER_SECTOR = HISTORY_SECTOR_SIZE / sizeof(HistoryRecord);
+const uint32_t RECORDS_PER_SECTOR = SLOTS_PER_SECTOR - 1;  // slot 0 holds the header
+const uint32_t MINUTES_PER_DAY = 1440;
+const uint32_t ERASED_START = 0xFFFFFF;
+
+struct SectorHeader {
+  uint32_t magic;
+  uint32_t sequence;  // increases by one per sector written
+};
+
+static_assert(sizeof(SectorHeader) == sizeof(HistoryRecord), "the header fills slot 0");
+
+// ---------------------------------------------------------------------------
+// Flash access: the partition on ESP32, a RAM image with the same rules
+// (erase to ones, writes only clear bits) elsewhere
+// ---------------------------------------------------------------------------
+
+#if defined(ESP32)
+const esp_partition_t* partition = nullptr;
+#else
+uint8_t hostFlash[HISTORY_HOST_FLASH_SIZE];
+bool hostFlashFormatted = false;
+#endif
+uint32_t sectorCount = 0;
+
+bool flashOpen() {
+#if defined(ESP32)
+  partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                       static_cast<esp_partition_subtype_t>(PARTITION_SUBTYPE),
+                                       "history");
+  if (partition == nullptr) {
+    return false;
+  }
+  sectorCount = partition->size / HISTORY_SECTOR_SIZE;
+#else
+  if (!hostFlashFormatted) {
+    memset(hostFlash, 0xFF, sizeof(hostFlash));
+    hostFlashFormatted = true;
+  }
+  sectorCount = HISTORY_HOST_FLASH_SIZE / HISTORY_SECTOR_SIZE;
+#endif
+  return sectorCount >= 2;
+}
+
+void flashRead(uint32_t offset, void* data, size_t size) {
+#if defined(ESP32)
+  esp_partition_read(partition, offset, data, size);
+#else
+  memcpy(data, hostFlash + offset, size);
+#endif
+}
+
+void flashWrite(uint32_t offset, const void* data, size_t size) {
+#if defined(ESP32)
+  esp_partition_write(partition, offset, data, size);
+#else
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < size; i++) {
+    hostFlash[offset + i] &= bytes[i];
+  }
+#endif
+}
+
+void flashEraseSector(uint32_t sector) {
+#if defined(ESP32)
+  esp_partition_erase_range(partition, sector * HISTORY_SECTOR_SIZE, HISTORY_SECTOR_SIZE);
+#else
+  memset(hostFlash + sector * HISTORY_SECTOR_SIZE, 0xFF, HISTORY_SECTOR_SIZE);
+#endif
+}
+
+uint32_t slotOffset(uint32_t sector, uint32_t slot) {
+  return sector * HISTORY_SECTOR_SIZE + slot * sizeof(HistoryRecord);
+}
+
+bool readHeader(uint32_t sector, SectorHeader* header) {
+  flashRead(slotOffset(sector, 0), header, sizeof(*header));
+  return header->magic == SECTOR_MAGIC;
+}
+
+bool slotErased(uint32_t sector, uint32_t slot) {
+  HistoryRecord record;
+  flashRead(slotOffset(sector, slot), &record, sizeof(record));
+  return record.startMinute == ERASED_START;
+}
+
+// ---------------------------------------------------------------------------
+// Log state
+// ---------------------------------------------------------------------------
+
+bool ready = false;
+uint32_t headSector = 0;
+uint32_t headSequence = 0;
+uint32_t headUsed = 0;     // records in the head sector
+uint32_t recordCount = 0;
+
+void startSector(uint32_t sector, uint32_t sequence) {
+  flashEraseSector(sector);
+  SectorHeader header = {SECTOR_MAGIC, sequence};
+  flashWrite(slotOffset(sector, 0), &header, sizeof(header));
+  headSector = sector;
+  headSequence = sequence;
+  headUsed = 0;
+}
+
+// ---------------------------------------------------------------------------
+// Rolling totals: one bucket per day of the window, indexed by day modulo
+// the window, plus the window sums
+// ---------------------------------------------------------------------------
+
+struct DayBucket {
+  uint32_t day;
+  uint32_t focusSeconds;
+  uint16_t sessions;
+  bool used;
+};
+
+DayBucket days[HISTORY_WINDOW_DAYS];
+uint32_t currentDay = 0;
+uint32_t weekFocusSeconds = 0;
+uint16_t weekSessions = 0;
+
+// Move the window forward, retiring the days that fall out of it
+void advanceTo(uint32_t day) {
+  if (day <= currentDay) {
+    return;
+  }
+  for (int i = 0; i < HISTORY_WINDOW_DAYS; i++) {
+    DayBucket& bucket = days[i];
+    if (bucket.used && bucket.day + HISTORY_WINDOW_DAYS <= day) {
+      weekFocusSeconds -= bucket.focusSeconds;
+      weekSessions -= bucket.sessions;
+      bucket = DayBucket{};
+    }
+  }
+  currentDay = day;
+}
+
+void addToTotals(const HistoryRecord& record) {
+  if (record.kind != HISTORY_WORK) {
+    return;
+  }
+  uint32_t day = record.startMinute / MINUTES_PER_DAY;
+  advanceTo(day);
+  if (day + HISTORY_WINDOW_DAYS <= currentDay) {
+    return;  // older than the window
+  }
+
+  DayBucket& bucket = days[day % HISTORY_WINDOW_DAYS];
+  if (!bucket.used) {
+    bucket.day = day;
+    bucket.used = true;
+  }
+  bucket.focusSeconds += record.actualSeconds;
+  bucket.sessions++;
+  weekFocusSeconds += record.actualSeconds;
+  weekSessions++;
+}
+
+void resetTotals() {
+  for (int i = 0; i < HISTORY_WINDOW_DAYS; i++) {
+    days[i] = DayBucket{};
+  }
+  currentDay = 0;
+  weekFocusSeconds = 0;
+  weekSessions = 0;
+}
+
+// ---------------------------------------------------------------------------
+// Device clock and the session being recorded
+// ---------------------------------------------------------------------------
+
+uint32_t clockBaseMinutes = 0;
+
+uint64_t uptimeMs() {
+#if defined(ESP32)
+  return static_cast<uint64_t>(esp_timer_get_time() / 1000);
+#else
+  return static_cast<uint64_t>(millis());
+#endif
+}
+
+struct ActiveSession {
+  bool active;
+  uint8_t kind;
+  uint32_t plannedSeconds;
+  uint32_t startMinute;
+  uint8_t pauses;
+  uint8_t presenceLosses;
+};
+
+ActiveSession session = {};
+}  // namespace
+
+bool history_init() {
+  ready = false;
+  recordCount = 0;
+  resetTotals();
+  if (!flashOpen()) {
+    LOG_W(LOG_POMODORO, "No history partition, sessions will not be logged");
+    return false;
+  }
+
+  // The head is the sector with the highest sequence number; every other
+  // valid sector is full
+  uint32_t validSectors = 0;
+  bool found = false;
+  for (uint32_t sector = 0; sector < sectorCount; sector++) {
+    SectorHeader header;
+    if (!readHeader(sector, &header)) {
+      continue;
+    }
+    validSectors++;
+    if (!found || static_cast<int32_t>(header.sequence - headSequence) > 0) {
+      headSector = sector;
+      headSequence = header.sequence;
+      found = true;
+    }
+  }
+
+  if (!found) {
+    startSector(0, 1);
+  } else {
+    // Records fill the head sector from slot 1 up; find the first erased slot
+    uint32_t lo = 0;
+    uint32_t hi = RECORDS_PER_SECTOR;
+    while (lo < hi) {
+      uint32_t mid = (lo + hi) / 2;
+      if (slotErased(headSector, mid + 1)) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+    headUsed = lo;
+    recordCount = (validSectors - 1) * RECORDS_PER_SECTOR + headUsed;
+  }
+  ready = true;
+
+  // Continue the device clock from the end of the newest session
+  HistoryRecord newest;
+  if (history_read(0, &newest)) {
+    clockBaseMinutes = newest.startMinute + (newest.actualSeconds + 59) / 60;
+  }
+
+  // Rebuild the totals from the records inside the window, newest first
+  uint32_t today = history_now_minutes() / MINUTES_PER_DAY;
+  advanceTo(today);
+  HistoryRecord record;
+  for (uint32_t i = 0; history_read(i, &record); i++) {
+    if (record.startMinute / MINUTES_PER_DAY + HISTORY_WINDOW_DAYS <= today) {
+      break;
+    }
+    addToTotals(record);
+  }
+
+  LOG_I(LOG_POMODORO, "History: %lu sessions logged (%lu sectors)",
+        static_cast<unsigned long>(recordCount), static_cast<unsigned long>(sectorCount));
+  return true;
+}
+
+uint32_t history_now_minutes() {
+  return clockBaseMinutes + static_cast<uint32_t>(uptimeMs() / 60000ULL);
+}
+
+void history_session_begin(HistoryKind kind, uint32_t plannedSeconds, uint32_t elapsedSeconds) {
+  session = ActiveSession{};
+  session.active = true;
+  session.kind = kind;
+  session.plannedSeconds = plannedSeconds;
+  uint32_t now = history_now_minutes();
+  uint32_t elapsedMinutes = elapsedSeconds / 60;
+  session.startMinute = now > elapsedMinutes ? now - elapsedMinutes : 0;
+}
+
+void history_session_pause() {
+  if (session.active && session.pauses < 31) {
+    session.pauses++;
+  }
+}
+
+void history_session_presence_lost() {
+  if (session.active && session.presenceLosses < 255) {
+    session.presenceLosses++;
+  }
+}
+
+void history_session_end(bool completed, uint32_t remainingSeconds) {
+  if (!session.active) {
+    return;
+  }
+  session.active = false;
+
+  uint32_t actual = session.plannedSeconds > remainingSeconds ? session.plannedSeconds - remainingSeconds : 0;
+  HistoryRecord record;
+  record.startMinute = session.startMinute;
+  record.kind = session.kind;
+  record.completed = completed ? 1 : 0;
+  record.pauses = session.pauses;
+  record.actualSeconds = static_cast<uint16_t>(actual < 0xFFFF ? actual : 0xFFFF);
+  uint32_t plannedMinutes = session.plannedSeconds / 60;
+  record.plannedMinutes = static_cast<uint8_t>(plannedMinutes < 0xFF ? plannedMinutes : 0xFF);
+  record.presenceLosses = session.presenceLosses;
+  if (!history_append(record)) {
+    return;
+  }
+
+  HistoryTotals totals;
+  history_get_totals(&totals);
+  LOG_I(LOG_POMODORO, "History: today %lu min focus in %u sessions, last %d days %lu min",
+        static_cast<unsigned long>(totals.todayFocusSeconds / 60), totals.todaySessions,
+        HISTORY_WINDOW_DAYS, static_cast<unsigned long>(totals.weekFocusSeconds / 60));
+}
+
+bool history_append(const HistoryRecord& record) {
+  if (!ready || record.startMinute == ERASED_START) {
+    return false;
+  }
+
+  if (headUsed >= RECORDS_PER_SECTOR) {
+    // Reuse the oldest sector; the records in it leave the log
+    uint32_t next = (headSector + 1) % sectorCount;
+    SectorHeader header;
+    if (readHeader(next, &header)) {
+      recordCount -= RECORDS_PER_SECTOR;
+    }
+    startSector(next, headSequence + 1);
+  }
+
+  flashWrite(slotOffset(headSector, headUsed + 1), &record, sizeof(record));
+  headUsed++;
+  recordCount++;
+  addToTotals(record);
+  return true;
+}
+
+void history_get_totals(HistoryTotals* totals) {
+  advanceTo(history_now_minutes() / MINUTES_PER_DAY);
+  const DayBucket& today = days[currentDay % HISTORY_WINDOW_DAYS];
+  bool current = today.used && today.day == currentDay;
+  totals->todayFocusSeconds = current ? today.focusSeconds : 0;
+  totals->todaySessions = current ? today.sessions : 0;
+  totals->weekFocusSeconds = weekFocusSeconds;
+  totals->weekSessions = weekSessions;
+  totals->records = recordCount;
+}
+
+bool history_read(uint32_t index, HistoryRecord* record) {
+  if (!ready || index >= recordCount) {
+    return false;
+  }
+
+  uint32_t sector;
+  uint32_t slot;
+  if (index < headUsed) {
+    sector = headSector;
+    slot = headUsed - index;
+  } else {
+    uint32_t back = index - headUsed;
+    uint32_t sectorsBack = 1 + back / RECORDS_PER_SECTOR;
+    sector = (headSector + sectorCount - sectorsBack % sectorCount) % sectorCount;
+    slot = RECORDS_PER_SECTOR - back % RECORDS_PER_SECTOR;
+  }
+  flashRead(slotOffset(sector, slot), record, sizeof(*record));
+  return true;
+}
+
+void history_clear() {
+  if (sectorCount == 0) {
+    return;
+  }
+  for (uint32_t sector = 0; sector < sectorCount; sector++) {
+    flashEraseSector(sector);
+  }
+  startSector(0, 1);
+  recordCount = 0;
+  resetTotals();
+  ready = true;
+}
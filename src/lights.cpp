@@ -1,23 +1,53 @@
 #include <Arduino.h>
 #include "lights.h"
+#include "log.h"
 
-// Initialize the LED pins
+// Self-test blink: both on, off, on, off. Each entry is how long the
+// step lasts; even steps are lit.
+static const unsigned long SELF_TEST_STEPS_MS[] = {200, 100, 200};
+static const int SELF_TEST_STEP_COUNT = sizeof(SELF_TEST_STEPS_MS) / sizeof(SELF_TEST_STEPS_MS[0]);
+static int selfTestStep = -1;  // -1 when not running
+static unsigned long selfTestStepStart = 0;
+
+// Initialize the LED pins and start the self-test blink
 void lights_init() {
-    Serial.println("Initializing LEDs...");
+    LOG_I(LOG_HARDWARE, "Initializing LEDs...");
 
     pinMode(GREEN_LED_PIN, OUTPUT);
     pinMode(RED_LED_PIN, OUTPUT);
 
-    // Initial test: quick blink to confirm LEDs are working
-    light_both_on();
-    delay(200);
-    light_both_off();
-    delay(100);
+    // Initial test: quick blink to confirm LEDs are working, played out by
+    // lights_update() so boot carries on meanwhile
     light_both_on();
-    delay(200);
-    light_both_off();
+    selfTestStep = 0;
+    selfTestStepStart = millis();
+}
+
+// Advance the self-test blink; true while it is still running
+bool lights_update() {
+    if (selfTestStep < 0) {
+        return false;
+    }
+
+    unsigned long now = millis();
+    while (selfTestStep < SELF_TEST_STEP_COUNT &&
+           now - selfTestStepStart >= SELF_TEST_STEPS_MS[selfTestStep]) {
+        selfTestStepStart += SELF_TEST_STEPS_MS[selfTestStep];
+        selfTestStep++;
+        if (selfTestStep % 2 == 0) {
+            light_both_on();
+        } else {
+            light_both_off();
+        }
+    }
 
-    Serial.println("LEDs initialized successfully!");
+    if (selfTestStep >= SELF_TEST_STEP_COUNT) {
+        light_both_off();
+        selfTestStep = -1;
+        LOG_I(LOG_HARDWARE, "LEDs initialized successfully!");
+        return false;
+    }
+    return true;
 }
 
 // Turn green LED on
@@ -0,0 +1,153 @@
+#include "log.h"
+
+#include <atomic>
+#include <stdarg.h>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace {
+const char LEVEL_LETTERS[] = {'-', 'E', 'W', 'I', 'D'};
+const char* const MODULE_NAMES[] = {"app", "pomodoro", "ultrasound", "request", "gambling", "hw"};
+
+// Single-consumer ring. head and tail run freely and are reduced modulo
+// the size on access; head is only written by log_write(), tail only by
+// the drain. On ESP32 more than one task logs, so writers take a lock.
+static_assert((LOG_BUFFER_SIZE & (LOG_BUFFER_SIZE - 1)) == 0,
+              "LOG_BUFFER_SIZE must be a power of two: head and tail wrap at 2^32");
+char ring[LOG_BUFFER_SIZE];
+std::atomic<uint32_t> head(0);
+std::atomic<uint32_t> tail(0);
+std::atomic<uint32_t> dropped(0);
+
+#if defined(ESP32)
+const uint32_t LOG_TASK_STACK = 2048;
+const UBaseType_t LOG_TASK_PRIORITY = 1;  // just above idle
+TaskHandle_t drainTaskHandle = nullptr;
+portMUX_TYPE pushLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+bool push(const char* text, size_t length) {
+  uint32_t h = head.load(std::memory_order_relaxed);
+  uint32_t t = tail.load(std::memory_order_acquire);
+  if (LOG_BUFFER_SIZE - (h - t) < length) {
+    return false;
+  }
+
+  size_t offset = h % LOG_BUFFER_SIZE;
+  size_t first = LOG_BUFFER_SIZE - offset;
+  if (first > length) {
+    first = length;
+  }
+  memcpy(ring + offset, text, first);
+  memcpy(ring, text + first, length - first);
+  head.store(h + length, std::memory_order_release);
+  return true;
+}
+
+// Hand at most `budget` buffered bytes to the UART; returns bytes written
+size_t drain(size_t budget) {
+  size_t written = 0;
+  uint32_t t = tail.load(std::memory_order_relaxed);
+  uint32_t h = head.load(std::memory_order_acquire);
+
+  while (t != h && written < budget) {
+    size_t offset = t % LOG_BUFFER_SIZE;
+    size_t chunk = h - t;
+    if (chunk > LOG_BUFFER_SIZE - offset) {
+      chunk = LOG_BUFFER_SIZE - offset;
+    }
+    if (chunk > budget - written) {
+      chunk = budget - written;
+    }
+    Serial.write(reinterpret_cast<const uint8_t*>(ring + offset), chunk);
+    t += chunk;
+    written += chunk;
+    tail.store(t, std::memory_order_release);
+  }
+  return written;
+}
+
+#if defined(ESP32)
+void drainTask(void* arg) {
+  (void)arg;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    // Serial.write() blocks while the UART FIFO is full, which only ever
+    // holds up this task
+    while (drain(LOG_BUFFER_SIZE) > 0) {
+    }
+  }
+}
+#endif
+}  // namespace
+
+void log_init() {
+#if defined(ESP32)
+  if (drainTaskHandle == nullptr) {
+    xTaskCreate(drainTask, "log_drain", LOG_TASK_STACK, nullptr,
+                LOG_TASK_PRIORITY, &drainTaskHandle);
+  }
+#endif
+}
+
+void log_update() {
+#if defined(ESP32)
+  if (drainTaskHandle != nullptr) {
+    return;
+  }
+#endif
+  int room = Serial.availableForWrite();
+  if (room > 0) {
+    drain(static_cast<size_t>(room));
+  }
+}
+
+void log_write(int level, LogModule module, const char* format, ...) {
+  char line[LOG_LINE_MAX];
+  int length = snprintf(line, sizeof(line), "[%lu][%c][%s] ", millis(),
+                        LEVEL_LETTERS[level], MODULE_NAMES[module]);
+
+  va_list args;
+  va_start(args, format);
+  int body = vsnprintf(line + length, sizeof(line) - length, format, args);
+  va_end(args);
+
+  // Clamp to what fit, then terminate the line (CRLF like println)
+  length += body;
+  if (body < 0 || length > static_cast<int>(sizeof(line)) - 3) {
+    length = sizeof(line) - 3;
+  }
+  line[length++] = '\r';
+  line[length++] = '\n';
+
+#if defined(ESP32)
+  portENTER_CRITICAL(&pushLock);
+  bool queued = push(line, length);
+  portEXIT_CRITICAL(&pushLock);
+#else
+  bool queued = push(line, length);
+#endif
+  if (!queued) {
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+#if defined(ESP32)
+  if (drainTaskHandle != nullptr) {
+    xTaskNotifyGive(drainTaskHandle);
+  }
+#endif
+}
+
+uint32_t log_dropped_count() {
+  return dropped.load(std::memory_order_relaxed);
+}
+
+size_t log_buffer_free() {
+  uint32_t t = tail.load(std::memory_order_acquire);
+  uint32_t h = head.load(std::memory_order_relaxed);
+  return LOG_BUFFER_SIZE - (h - t);
+}
@@ -1,5 +1,6 @@
 #include <Arduino.h>
 #include "config.h"
+#include "buttons.h"
 #include "pomodoro.h"
 #include "monitor.h"
 #include "ultrasound.h"
@@ -8,31 +9,27 @@
 #include "request.h"
 #include "gambling.h"
 #include "lights.h"
+#include "power.h"
+#include "boot.h"
+#include "persist.h"
+#include "history.h"
+#include "log.h"
+#include "profiler.h"
+#include "transitions.h"
 
 // ============================================================================
 // CONSTANTS
 // ============================================================================
 
 // Timing constants
-const unsigned long DEBOUNCE_DELAY_MS = 200;
-const unsigned long DOUBLE_CLICK_INTERVAL_MS = 350;
 const unsigned long SETTINGS_REENTRY_COOLDOWN_MS = 400;
 const unsigned long DISPLAY_UPDATE_INTERVAL_MS = 500;
 const unsigned long IDLE_DISPLAY_UPDATE_INTERVAL_MS = 100;
 const unsigned long ULTRASOUND_CHECK_INTERVAL_MS = 1000;
 const unsigned long SHAKING_COOLDOWN_MS = 2000;
 const unsigned long FINISHED_SCREEN_DISPLAY_MS = 3000;
-
-// ============================================================================
-// ENUMS
-// ============================================================================
-
-enum class AppMode {
-  NORMAL,
-  SETTINGS,
-  MENSA_MENU,
-  GAMBLING
-};
+const unsigned long LOOP_TICK_MS = 10;
+const unsigned long WIFI_POLL_INTERVAL_MS = 100;
 
 // ============================================================================
 // STATE VARIABLES
@@ -50,16 +47,14 @@ int settingsMinutes = 0;
 bool settingsRequireRelease = false;
 unsigned long settingsReentryBlockUntil = 0;
 
-// Button state
-bool button1LastState = HIGH;
-bool button2LastState = HIGH;
-unsigned long lastButton1Press = 0;
-unsigned long lastButton2Press = 0;
+// Button state (debounced, as last reported by button events)
+bool buttonDown[BUTTON_COUNT] = {false, false};
 bool button2SingleClickPending = false;
-unsigned long button2FirstClickTime = 0;
+uint32_t button2FirstClickUs = 0;
 
 // Display state
 unsigned long lastDisplayUpdate = 0;
+bool animationWasActive = false;
 
 // Ultrasound monitoring
 unsigned long lastUltrasoundCheck = 0;
@@ -70,9 +65,20 @@ bool isUserLost = false;
 volatile bool shakingDetected = false;
 unsigned long lastShakingTrigger = 0;
 
-// Mensa menu state
+// Mensa menu state. The item count is read from the published menu each
+// time: a background refresh may swap in a shorter one at any point.
 int mensaMenuIndex = 0;
-int mensaMenuTotal = 0;
+
+// WiFi
+WifiConnectionState lastWifiState = WIFI_CONN_IDLE;
+// Last outcome played on the buzzer (CONNECTED or FAILED), so reconnects
+// and repeated failed retries stay quiet
+WifiConnectionState lastWifiOutcome = WIFI_CONN_IDLE;
+// A connection came up while an older fetch was still running
+bool menuFetchQueued = false;
+
+// Boot stages still running from loop()
+bool bootLedTestRunning = false;
 
 // ============================================================================
 // HELPER FUNCTIONS - Settings
@@ -92,7 +98,9 @@ void enterSettingsMode(IdleMode mode) {
   }
 
   currentAppMode = AppMode::SETTINGS;
-  settingsRequireRelease = true;
+  // Buttons still held from the gesture that got us here must be released
+  // before a chord counts as confirmation
+  settingsRequireRelease = buttonDown[BUTTON_1] || buttonDown[BUTTON_2];
   settingsForWork = (mode == MODE_WORK);
   button2SingleClickPending = false;
 
@@ -102,8 +110,7 @@ void enterSettingsMode(IdleMode mode) {
     settingsMinutes = static_cast<int>(pomodoro_get_short_break_duration() / 60);
   }
 
-  Serial.print("Entering timer settings for ");
-  Serial.println(getSettingsLabel());
+  LOG_I(LOG_APP, "Entering timer settings for %s", getSettingsLabel());
   showSettingsScreen();
 }
 
@@ -123,11 +130,7 @@ void adjustSettingsBy(int deltaMinutes) {
   }
 
   settingsMinutes = newValue;
-  Serial.print("Adjusted ");
-  Serial.print(getSettingsLabel());
-  Serial.print(" duration to ");
-  Serial.print(settingsMinutes);
-  Serial.println(" minutes");
+  LOG_I(LOG_APP, "Adjusted %s duration to %d minutes", getSettingsLabel(), settingsMinutes);
   showSettingsScreen();
 }
 
@@ -144,11 +147,7 @@ void confirmSettings() {
     pomodoro_set_short_break_duration(seconds);
   }
 
-  Serial.print("Timer settings saved: ");
-  Serial.print(getSettingsLabel());
-  Serial.print(" set to ");
-  Serial.print(settingsMinutes);
-  Serial.println(" minutes");
+  LOG_I(LOG_APP, "Timer settings saved: %s set to %d minutes", getSettingsLabel(), settingsMinutes);
 
   selectedMode = settingsForWork ? MODE_WORK : MODE_BREAK;
   currentAppMode = AppMode::NORMAL;
@@ -163,53 +162,16 @@ void confirmSettings() {
 // HELPER FUNCTIONS - Button Actions
 // ============================================================================
 
-void handleButton2SingleAction(PomodoroState currentState) {
-  if (currentAppMode == AppMode::SETTINGS) {
-    adjustSettingsBy(5);
-    return;
-  }
-
-  if (currentAppMode == AppMode::MENSA_MENU) {
-    if (mensaMenuIndex < mensaMenuTotal - 1) {
-      mensaMenuIndex++;
-      Serial.print("Next menu item: ");
-      Serial.println(mensaMenuIndex + 1);
-      monitor_show_mensa_menu(mensaMenuIndex, mensaMenuTotal);
-    }
-    return;
-  }
-
-  if (currentState == POMODORO_IDLE) {
-    // Toggle between work and break mode
-    if (selectedMode == MODE_WORK) {
-      selectedMode = MODE_BREAK;
-      Serial.println("\n=== Mode: BREAK ===");
-    } else {
-      selectedMode = MODE_WORK;
-      Serial.println("\n=== Mode: WORK ===");
-    }
-    monitor_show_idle_screen(selectedMode, pomodoro_get_completed_count());
-    return;
-  }
-
-  // Reset timer when running
-  Serial.println("\n=== Resetting Timer ===");
-  pomodoro_reset();
-  lastPomodoroState = pomodoro_get_state();
-  isUserLost = false;
-  monitor_show_idle_screen(selectedMode, pomodoro_get_completed_count());
-}
-
 void startPomodoroSession() {
   if (selectedMode == MODE_WORK) {
-    Serial.println("\n=== Starting Work Session ===");
+    LOG_I(LOG_APP, "=== Starting Work Session ===");
     pomodoro_start_work();
     ultrasound_measure_initial_distance();
     ultrasoundCheckCount = 0;
     isUserLost = false;
     lastUltrasoundCheck = millis();
   } else {
-    Serial.println("\n=== Starting Break ===");
+    LOG_I(LOG_APP, "=== Starting Break ===");
     pomodoro_start_break();
   }
 
@@ -220,7 +182,7 @@ void startPomodoroSession() {
 }
 
 void pausePomodoro() {
-  Serial.println("\n=== Pausing Timer ===");
+  LOG_I(LOG_APP, "=== Pausing Timer ===");
   pomodoro_pause();
   lastPomodoroState = pomodoro_get_state();
   monitor_show_running_screen(pomodoro_get_state(),
@@ -229,7 +191,7 @@ void pausePomodoro() {
 }
 
 void resumePomodoro() {
-  Serial.println("\n=== Resuming Timer ===");
+  LOG_I(LOG_APP, "=== Resuming Timer ===");
   pomodoro_resume();
   lastPomodoroState = pomodoro_get_state();
   isUserLost = false;
@@ -242,14 +204,23 @@ void resumePomodoro() {
 // HELPER FUNCTIONS - Mode Management
 // ============================================================================
 
+// Draw the menu screen, keeping the index inside the menu published now
+void showMensaMenu() {
+  int count = request_get_menu_count();
+  if (mensaMenuIndex >= count) {
+    mensaMenuIndex = count > 0 ? count - 1 : 0;
+  }
+  monitor_show_mensa_menu(mensaMenuIndex);
+}
+
 void exitSpecialModes() {
   bool wasGambling = (currentAppMode == AppMode::GAMBLING);
 
   if (wasGambling) {
-    Serial.println("\n=== Exiting Gambling Mode ===");
+    LOG_I(LOG_APP, "=== Exiting Gambling Mode ===");
     gambling_reset();
   } else {
-    Serial.println("\n=== Exiting Mensa Menu Mode ===");
+    LOG_I(LOG_APP, "=== Exiting Mensa Menu Mode ===");
   }
 
   currentAppMode = AppMode::NORMAL;
@@ -271,195 +242,238 @@ void exitSpecialModes() {
   lastPomodoroState = currentState;
 }
 
-bool isInSpecialMode() {
-  return currentAppMode != AppMode::NORMAL;
-}
-
-bool isGamblingActive() {
-  return currentAppMode == AppMode::GAMBLING && gambling_choice_pending();
-}
-
-bool canEnterDoubleClickContext(unsigned long now) {
-  PomodoroState currentState = pomodoro_get_state();
-  bool isIdle = (currentState == POMODORO_IDLE);
-  bool noSpecialMode = (currentAppMode == AppMode::NORMAL);
-  bool cooldownExpired = (now >= settingsReentryBlockUntil);
-
-  return isIdle && noSpecialMode && cooldownExpired;
-}
-
 // ============================================================================
 // INTERRUPT HANDLERS
 // ============================================================================
 
 void IRAM_ATTR onShakingDetected() {
   shakingDetected = true;
+  power_wake_from_isr();
 }
 
 // ============================================================================
 // BUTTON HANDLING
 // ============================================================================
 
-void handleButton1Press(unsigned long now, PomodoroState currentState) {
-  bool button1State = digitalRead(BUTTON1_PIN);
+// What an input action gets to know about the input that triggered it
+struct InputContext {
+  unsigned long now;  // millis() when dispatched
+  uint32_t eventUs;   // micros() of the button edge
+};
 
-  if (button1State == LOW && button1LastState == HIGH &&
-      now - lastButton1Press > DEBOUNCE_DELAY_MS) {
+typedef void (*InputHandler)(const InputContext& context);
 
-    if (currentAppMode == AppMode::SETTINGS) {
-      adjustSettingsBy(-5);
-    }
-    else if (isGamblingActive()) {
-      bool win = false;
-      if (gambling_register_choice(GamblingChoice::Red, &win)) {
-        gambling_handle_result(GamblingChoice::Red, win);
-        currentAppMode = AppMode::MENSA_MENU;
-        monitor_show_mensa_menu(mensaMenuIndex, mensaMenuTotal);
-        lastPomodoroState = pomodoro_get_state();
-      }
-    }
-    else if (currentAppMode == AppMode::MENSA_MENU) {
-      if (mensaMenuIndex > 0) {
-        mensaMenuIndex--;
-        Serial.print("Previous menu item: ");
-        Serial.println(mensaMenuIndex + 1);
-        monitor_show_mensa_menu(mensaMenuIndex, mensaMenuTotal);
-      }
-    }
-    else if (currentState == POMODORO_IDLE) {
-      startPomodoroSession();
-    }
-    else if (currentState == POMODORO_WORK ||
-             currentState == POMODORO_SHORT_BREAK ||
-             currentState == POMODORO_LONG_BREAK) {
-      pausePomodoro();
-    }
-    else if (currentState == POMODORO_PAUSED) {
-      resumePomodoro();
-    }
+void actNone(const InputContext&) {}
 
-    lastButton1Press = now;
+void actSettingsDecrease(const InputContext&) {
+  adjustSettingsBy(-5);
+}
+
+void actSettingsIncrease(const InputContext&) {
+  adjustSettingsBy(5);
+}
+
+void actSettingsConfirm(const InputContext&) {
+  if (!settingsRequireRelease) {
+    confirmSettings();
   }
+}
 
-  button1LastState = button1State;
+void placeBet(GamblingChoice choice) {
+  bool win = false;
+  if (gambling_choice_pending() && gambling_register_choice(choice, &win)) {
+    // The result shows while loop() keeps running; handleGamblingResult()
+    // goes back to the menu when its time is up
+    gambling_handle_result(choice, win);
+    lastPomodoroState = pomodoro_get_state();
+  }
 }
 
-void handleButton2Press(unsigned long now, PomodoroState currentState) {
-  bool button2State = digitalRead(BUTTON2_PIN);
+void actGambleRed(const InputContext&) {
+  placeBet(GamblingChoice::Red);
+}
 
-  if (button2State == LOW && button2LastState == HIGH &&
-      now - lastButton2Press > DEBOUNCE_DELAY_MS) {
+void actGambleBlack(const InputContext&) {
+  placeBet(GamblingChoice::Black);
+}
 
-    if (currentAppMode == AppMode::SETTINGS) {
-      adjustSettingsBy(5);
-    }
-    else if (isGamblingActive()) {
-      bool win = false;
-      if (gambling_register_choice(GamblingChoice::Black, &win)) {
-        gambling_handle_result(GamblingChoice::Black, win);
-        currentAppMode = AppMode::MENSA_MENU;
-        monitor_show_mensa_menu(mensaMenuIndex, mensaMenuTotal);
-        lastPomodoroState = pomodoro_get_state();
-      }
-    }
-    else if (currentAppMode == AppMode::MENSA_MENU) {
-      if (mensaMenuIndex < mensaMenuTotal - 1) {
-        mensaMenuIndex++;
-        Serial.print("Next menu item: ");
-        Serial.println(mensaMenuIndex + 1);
-        monitor_show_mensa_menu(mensaMenuIndex, mensaMenuTotal);
-      }
-    }
-    else if (canEnterDoubleClickContext(now)) {
-      // Handle double-click for settings
-      if (button2SingleClickPending &&
-          (now - button2FirstClickTime <= DOUBLE_CLICK_INTERVAL_MS)) {
-        button2SingleClickPending = false;
-        enterSettingsMode(selectedMode);
-      } else {
-        button2SingleClickPending = true;
-        button2FirstClickTime = now;
-      }
-    }
-    else {
-      handleButton2SingleAction(currentState);
-      button2SingleClickPending = false;
-    }
+void actMenuPrevious(const InputContext&) {
+  if (mensaMenuIndex > 0) {
+    mensaMenuIndex--;
+    LOG_I(LOG_APP, "Previous menu item: %d", mensaMenuIndex + 1);
+    showMensaMenu();
+  }
+}
 
-    lastButton2Press = now;
+void actMenuNext(const InputContext&) {
+  if (mensaMenuIndex < request_get_menu_count() - 1) {
+    mensaMenuIndex++;
+    LOG_I(LOG_APP, "Next menu item: %d", mensaMenuIndex + 1);
+    showMensaMenu();
   }
+}
 
-  button2LastState = button2State;
+void actExitSpecialMode(const InputContext&) {
+  exitSpecialModes();
 }
 
-void handleButton2SingleClickTimeout(unsigned long now, PomodoroState currentState) {
-  if (!button2SingleClickPending) {
-    return;
-  }
+void actStartSession(const InputContext&) {
+  startPomodoroSession();
+}
 
-  bool doubleClickExpired = !canEnterDoubleClickContext(now) ||
-                           (now - button2FirstClickTime > DOUBLE_CLICK_INTERVAL_MS);
+void actPauseSession(const InputContext&) {
+  pausePomodoro();
+}
 
-  if (doubleClickExpired) {
-    button2SingleClickPending = false;
-    handleButton2SingleAction(currentState);
-  }
+void actResumeSession(const InputContext&) {
+  resumePomodoro();
 }
 
-void handleBothButtonsPressed(unsigned long now, PomodoroState currentState) {
-  bool button1State = digitalRead(BUTTON1_PIN);
-  bool button2State = digitalRead(BUTTON2_PIN);
-  bool bothPressed = (button1State == LOW && button2State == LOW);
-  bool bothDebounced = (now - lastButton1Press > DEBOUNCE_DELAY_MS &&
-                        now - lastButton2Press > DEBOUNCE_DELAY_MS);
+void actResetSession(const InputContext&) {
+  LOG_I(LOG_APP, "=== Resetting Timer ===");
+  pomodoro_reset();
+  lastPomodoroState = pomodoro_get_state();
+  isUserLost = false;
+  button2SingleClickPending = false;
+  monitor_show_idle_screen(selectedMode, pomodoro_get_completed_count());
+}
 
-  if (!bothPressed || !bothDebounced) {
-    return;
+void actToggleMode(const InputContext&) {
+  if (selectedMode == MODE_WORK) {
+    selectedMode = MODE_BREAK;
+    LOG_I(LOG_APP, "=== Mode: BREAK ===");
+  } else {
+    selectedMode = MODE_WORK;
+    LOG_I(LOG_APP, "=== Mode: WORK ===");
   }
+  monitor_show_idle_screen(selectedMode, pomodoro_get_completed_count());
+}
 
-  // Settings mode: confirm settings
-  if (currentAppMode == AppMode::SETTINGS && !settingsRequireRelease) {
-    confirmSettings();
-    lastButton1Press = now;
-    lastButton2Press = now;
-    button1LastState = button1State;
-    button2LastState = button2State;
-    return;
+// A lone click toggles the mode, but only once the double-click window has
+// passed without a second click (or right away during the settings cooldown)
+void actButton2Click(const InputContext& context) {
+  if (context.now >= settingsReentryBlockUntil) {
+    button2SingleClickPending = true;
+    button2FirstClickUs = context.eventUs;
+  } else {
+    button2SingleClickPending = false;
+    actToggleMode(context);
   }
+}
 
-  // Exit special modes (Mensa Menu or Gambling)
-  if (isInSpecialMode() && currentAppMode != AppMode::SETTINGS) {
-    exitSpecialModes();
-    lastButton1Press = now;
-    lastButton2Press = now;
-    button1LastState = button1State;
-    button2LastState = button2State;
-    return;
+void actButton2DoubleClick(const InputContext& context) {
+  if (button2SingleClickPending && context.now >= settingsReentryBlockUntil) {
+    button2SingleClickPending = false;
+    enterSettingsMode(selectedMode);
+  } else {
+    actButton2Click(context);
   }
+}
 
-  // Enter settings mode
-  if (currentAppMode == AppMode::NORMAL &&
-      currentState == POMODORO_IDLE &&
-      now >= settingsReentryBlockUntil) {
+void actEnterSettings(const InputContext& context) {
+  if (context.now >= settingsReentryBlockUntil) {
     enterSettingsMode(selectedMode);
-    lastButton1Press = now;
-    lastButton2Press = now;
-    button1LastState = button1State;
-    button2LastState = button2State;
-    return;
   }
 }
 
-void handleSettingsButtonRelease() {
-  if (currentAppMode != AppMode::SETTINGS || !settingsRequireRelease) {
+// Indexed by InputAction
+const InputHandler INPUT_HANDLERS[] = {
+  actNone,                // UNDEFINED (never in the table)
+  actNone,                // NONE
+  actSettingsDecrease,    // SETTINGS_DECREASE
+  actSettingsIncrease,    // SETTINGS_INCREASE
+  actSettingsConfirm,     // SETTINGS_CONFIRM
+  actGambleRed,           // GAMBLE_RED
+  actGambleBlack,         // GAMBLE_BLACK
+  actMenuPrevious,        // MENU_PREVIOUS
+  actMenuNext,            // MENU_NEXT
+  actExitSpecialMode,     // EXIT_SPECIAL_MODE
+  actStartSession,        // START_SESSION
+  actPauseSession,        // PAUSE_SESSION
+  actResumeSession,       // RESUME_SESSION
+  actResetSession,        // RESET_SESSION
+  actButton2Click,        // BUTTON2_CLICK
+  actButton2DoubleClick,  // BUTTON2_DOUBLE_CLICK
+  actToggleMode,          // TOGGLE_MODE
+  actEnterSettings        // ENTER_SETTINGS
+};
+
+static_assert(sizeof(INPUT_HANDLERS) / sizeof(INPUT_HANDLERS[0]) ==
+                  static_cast<size_t>(InputAction::COUNT),
+              "every InputAction needs a handler");
+
+void dispatchInput(InputEvent input, uint32_t eventUs) {
+  InputContext context;
+  context.now = millis();
+  context.eventUs = eventUs;
+  InputAction action = input_action(currentAppMode, pomodoro_get_state(), input);
+  INPUT_HANDLERS[static_cast<int>(action)](context);
+}
+
+void handleButton2SingleClickTimeout(unsigned long now) {
+  if (!button2SingleClickPending) {
     return;
   }
 
-  bool button1State = digitalRead(BUTTON1_PIN);
-  bool button2State = digitalRead(BUTTON2_PIN);
+  // The held-back click acts once its window is over, or is dropped if the
+  // screen it was meant for has gone in the meantime
+  bool screenChanged = currentAppMode != AppMode::NORMAL ||
+                       pomodoro_get_state() != POMODORO_IDLE ||
+                       now < settingsReentryBlockUntil;
+  if (screenChanged || micros() - button2FirstClickUs > BUTTON_DOUBLE_CLICK_MS * 1000UL) {
+    dispatchInput(InputEvent::BUTTON2_CLICK_TIMEOUT, button2FirstClickUs);
+    button2SingleClickPending = false;
+    profiler_record_latency(micros() - button2FirstClickUs);
+  }
+}
+
+// Run every queued button event through the dispatch table, oldest first.
+// Edges are captured by interrupt, so a press made while loop() was
+// blocked arrives here late but is never lost.
+void handleButtonEvents() {
+  ButtonEvent event;
+  while (buttons_next_event(&event)) {
+    LOG_D(LOG_APP, "Button %d event %d", event.button + 1, event.type);
+
+    InputEvent input;
+    switch (event.type) {
+      case BUTTON_EVENT_PRESS:
+        buttonDown[event.button] = true;
+        input = (event.button == BUTTON_1) ? InputEvent::BUTTON1_PRESS : InputEvent::BUTTON2_PRESS;
+        break;
+
+      case BUTTON_EVENT_DOUBLE_CLICK:
+        buttonDown[event.button] = true;
+        input = (event.button == BUTTON_1) ? InputEvent::BUTTON1_PRESS
+                                           : InputEvent::BUTTON2_DOUBLE_CLICK;
+        break;
+
+      case BUTTON_EVENT_CHORD:
+        buttonDown[event.button] = true;
+        input = InputEvent::BOTH_PRESSED;
+        break;
+
+      case BUTTON_EVENT_RELEASE:
+        buttonDown[event.button] = false;
+        // Settings entered with a chord are confirmed by the next chord,
+        // not by the one still being held
+        if (!buttonDown[BUTTON_1] && !buttonDown[BUTTON_2]) {
+          settingsRequireRelease = false;
+        }
+        continue;
+
+      case BUTTON_EVENT_LONG_PRESS:
+      default:
+        continue;
+    }
 
-  if (button1State == HIGH && button2State == HIGH) {
-    settingsRequireRelease = false;
+    dispatchInput(input, event.timeUs);
+
+    // A click held back for the double-click window is timed when it acts
+    if (button2SingleClickPending && button2FirstClickUs == event.timeUs) {
+      continue;
+    }
+    profiler_record_latency(micros() - event.timeUs);
   }
 }
 
@@ -478,7 +492,7 @@ void handleTimerCompletion() {
     return;
   }
 
-  Serial.println("\n=== Timer Finished! ===");
+  LOG_I(LOG_APP, "=== Timer Finished! ===");
   buzzer_play_sound_happy1();
   monitor_show_finished_screen(pomodoro_get_completed_count());
   delay(FINISHED_SCREEN_DISPLAY_MS);
@@ -486,61 +500,62 @@ void handleTimerCompletion() {
   isUserLost = false;
 }
 
+// Presence is checked during work sessions, paused or not
+bool isMonitoringPresence(PomodoroState state) {
+  return currentAppMode != AppMode::MENSA_MENU &&
+         (state == POMODORO_WORK || state == POMODORO_PAUSED);
+}
+
 void handleUltrasoundMonitoring(unsigned long now, PomodoroState currentState) {
-  bool shouldMonitor = (currentAppMode != AppMode::MENSA_MENU) &&
-                       (currentState == POMODORO_WORK || currentState == POMODORO_PAUSED);
+  if (!isMonitoringPresence(currentState)) {
+    return;
+  }
 
-  if (!shouldMonitor || (now - lastUltrasoundCheck < ULTRASOUND_CHECK_INTERVAL_MS)) {
+  // Fire the next ping on schedule; its echo is collected in the background
+  if (now - lastUltrasoundCheck >= ULTRASOUND_CHECK_INTERVAL_MS) {
+    ultrasound_take_single_measurement();
+    lastUltrasoundCheck = now;
+  }
+
+  if (!ultrasound_measurement_ready()) {
     return;
   }
 
-  ultrasound_take_single_measurement();
   float currentDistance = ultrasound_get_single_measurement();
 
   int arrayIndex = ultrasoundCheckCount % 3;
   ultrasound_store_measurement(arrayIndex, currentDistance);
   ultrasoundCheckCount++;
 
-  Serial.print("Distance check #");
-  Serial.print(ultrasoundCheckCount);
-  Serial.print(": ");
-  Serial.print(currentDistance);
-  Serial.println(" cm");
+  LOG_D(LOG_APP, "Distance check #%d: %.2f cm", ultrasoundCheckCount, currentDistance);
 
   if (ultrasoundCheckCount >= 3) {
     bool withinRange = ultrasound_compare_range();
 
     if (!withinRange && !isUserLost) {
       // User left workspace
-      Serial.println("!!! USER OUT OF RANGE !!!");
+      LOG_I(LOG_APP, "!!! USER OUT OF RANGE !!!");
       isUserLost = true;
+      history_session_presence_lost();
       pomodoro_pause();
       lastPomodoroState = pomodoro_get_state();
-      Serial.println("Timer paused due to user out of range");
+      LOG_I(LOG_APP, "Timer paused due to user out of range");
       buzzer_play_sound_sad1();
       monitor_roboeyes_show_lost();
-      monitor_show_running_screen(pomodoro_get_state(),
-                                  pomodoro_get_time_remaining(),
-                                  pomodoro_get_completed_count());
     }
     else if (withinRange && isUserLost) {
       // User returned
-      Serial.println("!!! USER RETURNED TO RANGE !!!");
+      LOG_I(LOG_APP, "!!! USER RETURNED TO RANGE !!!");
       isUserLost = false;
       monitor_roboeyes_show_return();
       pomodoro_resume();
       lastPomodoroState = pomodoro_get_state();
-      Serial.println("Timer resumed - user back in range");
+      LOG_I(LOG_APP, "Timer resumed - user back in range");
       buzzer_play_sound_happy1();
-      monitor_show_running_screen(pomodoro_get_state(),
-                                  pomodoro_get_time_remaining(),
-                                  pomodoro_get_completed_count());
     }
 
     ultrasoundCheckCount = 0;
   }
-
-  lastUltrasoundCheck = now;
 }
 
 void handleShakingSensor(unsigned long now) {
@@ -552,27 +567,23 @@ void handleShakingSensor(unsigned long now) {
 
   // Enter Mensa Menu mode
   if (currentAppMode == AppMode::NORMAL) {
-    Serial.println("!!! SHAKING DETECTED (INSTANT) !!!");
+    LOG_I(LOG_APP, "!!! SHAKING DETECTED (INSTANT) !!!");
     monitor_roboeyes_show_shake();
 
     currentAppMode = AppMode::MENSA_MENU;
     mensaMenuIndex = 0;
-    mensaMenuTotal = request_get_menu_count();
 
-    Serial.println("Entering Mensa Menu Mode");
-    Serial.print("Total menu items: ");
-    Serial.println(mensaMenuTotal);
+    LOG_I(LOG_APP, "Entering Mensa Menu Mode (%d menu items)", request_get_menu_count());
 
-    monitor_show_mensa_menu(mensaMenuIndex, mensaMenuTotal);
+    // The menu is drawn once the shake animation has finished
     lastShakingTrigger = now;
     return;
   }
 
   // Activate Gambling mode
   if (currentAppMode == AppMode::MENSA_MENU && !gambling_choice_pending()) {
-    Serial.println("\n=== Gambling Mode Activated ===");
-    Serial.println("Shake detected while in menu.");
-    Serial.println("Press BTN1 for RED or BTN2 for BLACK to place your bet.");
+    LOG_I(LOG_APP, "=== Gambling Mode Activated === Shake detected while in menu.");
+    LOG_I(LOG_APP, "Press BTN1 for RED or BTN2 for BLACK to place your bet.");
     gambling_start();
     currentAppMode = AppMode::GAMBLING;
     monitor_gambling_show_intro();
@@ -581,7 +592,104 @@ void handleShakingSensor(unsigned long now) {
   }
 }
 
+void handleGamblingResult(unsigned long now) {
+  if (currentAppMode != AppMode::GAMBLING || !gambling_update(now)) {
+    return;
+  }
+  currentAppMode = AppMode::MENSA_MENU;
+  showMensaMenu();
+}
+
+void handleWiFi() {
+  WifiConnectionState state = request_update();
+  if (state == lastWifiState) {
+    return;
+  }
+  lastWifiState = state;
+
+  if (state == WIFI_CONN_CONNECTED) {
+    LOG_I(LOG_APP, ">>> WiFi connected successfully!");
+    boot_phase_end(BOOT_WIFI);
+    if (lastWifiOutcome != WIFI_CONN_CONNECTED) {
+      buzzer_play_sound_happy1();
+    }
+    lastWifiOutcome = state;
+    // Every new connection (first one, after a drop or a failed series)
+    // brings the menu up to date
+    LOG_I(LOG_APP, ">>> Fetching Mensa Menu...");
+    boot_phase_begin(BOOT_MENU);
+    menuFetchQueued = !request_start_menu_fetch();
+  } else if (state == WIFI_CONN_FAILED) {
+    LOG_W(LOG_APP, ">>> WiFi connection failed! Continuing without WiFi, retrying later...");
+    boot_phase_end(BOOT_WIFI);
+    if (lastWifiOutcome != WIFI_CONN_FAILED) {
+      buzzer_play_sound_sad1();
+    }
+    lastWifiOutcome = state;
+  }
+}
+
+// The menu is fetched in the background; pick up the result when it lands
+void handleMenuFetch() {
+  bool ok = false;
+  if (!request_menu_fetch_finished(&ok)) {
+    return;
+  }
+  boot_phase_end(BOOT_MENU);
+
+  // Show the refreshed menu if it is on screen right now
+  if (ok && currentAppMode == AppMode::MENSA_MENU && !monitor_animation_is_active()) {
+    showMensaMenu();
+  }
+
+  // That one started on a link that has since dropped: fetch again
+  if (menuFetchQueued && request_is_wifi_connected()) {
+    menuFetchQueued = !request_start_menu_fetch();
+  }
+}
+
+// Redraw whatever screen belongs to the current mode
+void refreshCurrentScreen() {
+  switch (currentAppMode) {
+    case AppMode::SETTINGS:
+      showSettingsScreen();
+      break;
+    case AppMode::MENSA_MENU:
+      showMensaMenu();
+      break;
+    case AppMode::GAMBLING:
+      gambling_show_screen();
+      break;
+    case AppMode::NORMAL:
+    default:
+      if (pomodoro_get_state() == POMODORO_IDLE) {
+        monitor_show_idle_screen(selectedMode, pomodoro_get_completed_count());
+      } else {
+        monitor_show_running_screen(pomodoro_get_state(),
+                                    pomodoro_get_time_remaining(),
+                                    pomodoro_get_completed_count());
+      }
+      break;
+  }
+  lastDisplayUpdate = millis();
+}
+
+void handleAnimation() {
+  bool active = monitor_animation_update();
+
+  // Sequence just ended: put the regular screen back
+  if (!active && animationWasActive) {
+    refreshCurrentScreen();
+  }
+  animationWasActive = active;
+}
+
 void updateDisplay(unsigned long now, PomodoroState currentState) {
+  // The eyes own the display while an animation is playing
+  if (monitor_animation_is_active()) {
+    return;
+  }
+
   // Don't update display when in special modes (they manage their own display)
   if (currentAppMode == AppMode::SETTINGS ||
       currentAppMode == AppMode::MENSA_MENU ||
@@ -590,7 +698,9 @@ void updateDisplay(unsigned long now, PomodoroState currentState) {
   }
 
   if (currentState == POMODORO_IDLE) {
-    if (now - lastDisplayUpdate >= IDLE_DISPLAY_UPDATE_INTERVAL_MS) {
+    // Redraw only when the banner has moved on; the rest is static
+    if (now - lastDisplayUpdate >= IDLE_DISPLAY_UPDATE_INTERVAL_MS &&
+        monitor_banner_ms_until_change(now) == 0) {
       monitor_show_idle_screen(selectedMode, pomodoro_get_completed_count());
       lastDisplayUpdate = now;
     }
@@ -608,6 +718,131 @@ void updateDisplay(unsigned long now, PomodoroState currentState) {
   }
 }
 
+// ============================================================================
+// BOOT PIPELINE
+// ============================================================================
+
+// Steps the boot stages that outlive setup(): the LED self-test hands over
+// to the startup jingle, and the first screen after the intro (or after an
+// input cut it short) marks the device interactive
+void handleBoot() {
+  if (bootLedTestRunning && !lights_update()) {
+    bootLedTestRunning = false;
+    boot_phase_end(BOOT_LED_TEST);
+    boot_phase_begin(BOOT_JINGLE);
+    buzzer_play_sound_turn_on();
+  }
+  if (!buzzer_is_playing()) {
+    boot_phase_end(BOOT_JINGLE);
+  }
+
+  if (!boot_is_interactive() && !monitor_animation_is_active()) {
+    boot_phase_end(BOOT_INTRO);
+    monitor_wait_for_flush();
+    boot_mark_interactive();
+  }
+}
+
+// ============================================================================
+// POWER MANAGEMENT
+// ============================================================================
+
+unsigned long msUntil(unsigned long dueAt, unsigned long now) {
+  long remaining = static_cast<long>(dueAt - now);
+  return remaining > 0 ? static_cast<unsigned long>(remaining) : 0;
+}
+
+// How long loop() can wait before it next has something to do
+unsigned long msUntilNextWork(unsigned long now) {
+  // Work that is polled rather than scheduled keeps the regular tick
+  if (monitor_animation_is_active() || buzzer_is_playing() || ultrasound_is_busy() ||
+      bootLedTestRunning ||
+      buttonDown[BUTTON_1] || buttonDown[BUTTON_2] || shakingDetected ||
+      log_buffer_free() < LOG_BUFFER_SIZE || profiler_is_reporting()) {
+    return LOOP_TICK_MS;
+  }
+
+  unsigned long wait = POWER_MAX_SLEEP_MS;
+  PomodoroState state = pomodoro_get_state();
+
+  // End of the running session
+  if (pomodoro_is_running()) {
+    wait = min(wait, pomodoro_get_ms_until_deadline());
+  }
+
+  // Next screen change: the countdown, or the banner on the idle screen
+  if (currentAppMode == AppMode::NORMAL) {
+    if (state == POMODORO_IDLE) {
+      unsigned long redraw = max(msUntil(lastDisplayUpdate + IDLE_DISPLAY_UPDATE_INTERVAL_MS, now),
+                                 monitor_banner_ms_until_change(now));
+      wait = min(wait, redraw);
+    } else {
+      wait = min(wait, msUntil(lastDisplayUpdate + DISPLAY_UPDATE_INTERVAL_MS, now));
+    }
+  }
+
+  // End of the gambling result screen
+  if (gambling_showing_result()) {
+    wait = min(wait, gambling_ms_until_result_end(now));
+  }
+
+  // Next presence ping
+  if (isMonitoringPresence(state)) {
+    wait = min(wait, msUntil(lastUltrasoundCheck + ULTRASOUND_CHECK_INTERVAL_MS, now));
+  }
+
+  // Next snapshot of the timer state
+  wait = min(wait, persist_ms_until_write(now));
+
+  // A held-back click acts when its double-click window closes
+  if (button2SingleClickPending) {
+    unsigned long heldMs = (micros() - button2FirstClickUs) / 1000UL;
+    wait = min(wait, heldMs < BUTTON_DOUBLE_CLICK_MS ? BUTTON_DOUBLE_CLICK_MS - heldMs + 1 : 0UL);
+  }
+
+  // The WiFi state machine polls the link while it connects, and a
+  // background menu fetch is collected the same way
+  WifiConnectionState wifi = request_get_wifi_state();
+  if (wifi == WIFI_CONN_CONNECTING || wifi == WIFI_CONN_BACKOFF || request_menu_fetch_running()) {
+    wait = min(wait, WIFI_POLL_INTERVAL_MS);
+  }
+  // With the radio off after a failed series, wake for the next one
+  if (wifi == WIFI_CONN_FAILED) {
+    wait = min(wait, request_ms_until_wifi_retry(now));
+  }
+
+  return wait;
+}
+
+// Light sleep stops the radio, the LEDC tone, the echo timing and the
+// UART, so it is only allowed while none of them is in use
+bool canLightSleep() {
+  WifiConnectionState wifi = request_get_wifi_state();
+  // A retry that is due turns the radio on in this loop() pass
+  bool radioOff = (wifi == WIFI_CONN_IDLE ||
+                   (wifi == WIFI_CONN_FAILED && request_ms_until_wifi_retry(millis()) > 0));
+  return radioOff && !buzzer_is_playing() && !monitor_animation_is_active() &&
+         !ultrasound_is_busy() && log_buffer_free() == LOG_BUFFER_SIZE;
+}
+
+void idleUntilNextWork() {
+  unsigned long now = millis();
+  unsigned long waitMs = msUntilNextWork(now);
+  bool lightSleep = canLightSleep();
+  if (lightSleep) {
+    monitor_wait_for_flush();
+  }
+
+  // Edge interrupts are masked during light sleep, so the pin that ended
+  // it stands in for the edge that was missed
+  int wakePin = power_idle(waitMs, lightSleep);
+  if (wakePin == SHAKING_PIN) {
+    shakingDetected = true;
+  } else if (wakePin >= 0) {
+    buttons_resync();
+  }
+}
+
 }  
 
 // ============================================================================
@@ -616,47 +851,48 @@ void updateDisplay(unsigned long now, PomodoroState currentState) {
 
 void initializeSerial() {
   Serial.begin(115200);
-  delay(500);
   Serial.println("\n\n=================================");
   Serial.println("   ESP32 Pomodoro Timer v1.0");
   Serial.println("=================================\n");
+  log_init();
+  profiler_init();
 }
 
 void initializeInputPins() {
-  pinMode(BUTTON1_PIN, INPUT_PULLUP);
-  pinMode(BUTTON2_PIN, INPUT_PULLUP);
-  button1LastState = digitalRead(BUTTON1_PIN);
-  button2LastState = digitalRead(BUTTON2_PIN);
+  buttons_init();
 }
 
 void initializeOutputs() {
   buzzer_init();  // Uses BUZZER_PIN from buzzer.h
-  buzzer_play_sound_turn_on();
+  // Blinks on from loop(); the startup jingle follows it
   lights_init();
+  bootLedTestRunning = true;
+  boot_phase_begin(BOOT_LED_TEST);
 }
 
 void initializeDisplay() {
   if (!monitor_init()) {  // Uses SDA_PIN and SCL_PIN from monitor.h
-    Serial.println("Failed to initialize monitor!");
+    LOG_E(LOG_APP, "Failed to initialize monitor!");
     for(;;);
   }
   monitor_roboeyes_init();
-  monitor_roboeyes_show_init();
-}
-
-void initializeWiFi() {
-  Serial.println(">>> Initializing WiFi...");
-  if (request_init(WIFI_SSID, WIFI_PASSWORD)) {
-    Serial.println(">>> WiFi connected successfully!\n");
-    buzzer_play_sound_happy1();
-    light_alternate_3sec();
-    Serial.println(">>> Fetching Mensa Menu...");
-    request_fetch_mensa_menu();
-    Serial.println();
+}
+
+// Slow stages that run side by side from loop() once setup() returns
+void startBackgroundStages() {
+  // A session restored after a reset goes straight back on screen; the
+  // greeting is only for a fresh start
+  if (pomodoro_get_state() == POMODORO_IDLE) {
+    boot_phase_begin(BOOT_INTRO);
+    monitor_roboeyes_show_init();
   } else {
-    Serial.println(">>> WiFi connection failed! Continuing without WiFi...\n");
-    buzzer_play_sound_sad1();
+    refreshCurrentScreen();
   }
+
+  LOG_I(LOG_APP, ">>> Initializing WiFi (connects in the background)...");
+  boot_phase_begin(BOOT_WIFI);
+  request_begin(WIFI_SSID, WIFI_PASSWORD);
+  lastWifiState = request_get_wifi_state();
 }
 
 void initializeSensors() {
@@ -667,35 +903,46 @@ void initializeSensors() {
   shaking_attach_interrupt(onShakingDetected);
 }
 
+void initializePower() {
+  power_init();
+  power_add_wake_pin(BUTTON1_PIN, CHANGE);
+  power_add_wake_pin(BUTTON2_PIN, CHANGE);
+  power_add_wake_pin(SHAKING_PIN, FALLING);
+}
+
 void initializePomodoro() {
   pomodoro_init();
-  lastPomodoroState = pomodoro_get_state();
-  Serial.println("Pomodoro Timer Initialized");
-  Serial.println("BTN1 (D5): Start/Pause");
-  Serial.println("BTN2 (D4): Toggle Mode / Next/Reset");
-}
 
-void showInitialScreen() {
-  monitor_show_idle_screen(selectedMode, pomodoro_get_completed_count());
+  // Pick up where a reset interrupted us
+  history_init();
+  persist_init();
+  PomodoroSnapshot snapshot;
+  if (persist_load_pomodoro(&snapshot)) {
+    pomodoro_restore(snapshot);
+  }
+  lastPomodoroState = pomodoro_get_state();
+  LOG_I(LOG_APP, "Pomodoro Timer Initialized. BTN1 (D5): Start/Pause, BTN2 (D4): Toggle Mode / Next/Reset");
 }
 
 // ============================================================================
 // MAIN FUNCTIONS
 // ============================================================================
 
+// setup() runs the quick init steps in dependency order and starts the slow
+// ones; the idle screen appears when the eyes intro is over
 void setup() {
-  initializeSerial();
-  initializeInputPins();
-  initializeOutputs();
-  initializeDisplay();
-  initializeWiFi();
-  initializeSensors();
-  initializePomodoro();
-  showInitialScreen();
+  BOOT_STEP(BOOT_SERIAL, initializeSerial());
+  BOOT_STEP(BOOT_INPUTS, initializeInputPins());
+  BOOT_STEP(BOOT_OUTPUTS, initializeOutputs());
+  BOOT_STEP(BOOT_DISPLAY, initializeDisplay());
+  BOOT_STEP(BOOT_SENSORS, initializeSensors(); initializePower());
+  BOOT_STEP(BOOT_POMODORO, initializePomodoro());
+  startBackgroundStages();
 }
 
 void loop() {
-  pomodoro_update();
+  profiler_loop_begin();
+  PROFILE_CALL(PROF_POMODORO, pomodoro_update());
   unsigned long now = millis();
   PomodoroState currentState = pomodoro_get_state();
 
@@ -705,18 +952,22 @@ void loop() {
   }
 
   // Handle button inputs
-  handleSettingsShakingBlock();
-  handleSettingsButtonRelease();
-  handleBothButtonsPressed(now, currentState);
-  handleButton2SingleClickTimeout(now, currentState);
-  handleButton1Press(now, currentState);
-  handleButton2Press(now, currentState);
+  PROFILE_CALL(PROF_BUTTONS, handleSettingsShakingBlock(); handleButtonEvents();
+               handleButton2SingleClickTimeout(now));
 
   // Handle monitoring and events
-  handleTimerCompletion();
-  handleUltrasoundMonitoring(now, currentState);
-  handleShakingSensor(now);
-  updateDisplay(now, currentState);
-
-  delay(10);
+  PROFILE_CALL(PROF_TIMER_COMPLETION, handleTimerCompletion());
+  PROFILE_CALL(PROF_ULTRASOUND, ultrasound_update(); handleUltrasoundMonitoring(now, currentState));
+  PROFILE_CALL(PROF_SHAKING, handleShakingSensor(now); handleGamblingResult(now));
+  PROFILE_CALL(PROF_WIFI, handleWiFi(); handleMenuFetch());
+  PROFILE_CALL(PROF_ANIMATION, handleAnimation());
+  PROFILE_CALL(PROF_DISPLAY, updateDisplay(now, currentState));
+  PROFILE_CALL(PROF_BUZZER, buzzer_update());
+  PROFILE_CALL(PROF_BOOT, handleBoot());
+  PROFILE_CALL(PROF_PERSIST, persist_update(now));
+  PROFILE_CALL(PROF_LOG, log_update());
+  profiler_update();
+  profiler_loop_end();
+
+  idleUntilNextWork();
 }
@@ -1,16 +1,20 @@
 #include "monitor.h"
+#include "format.h"
+#include "atlas.h"
+#include "text.h"
+#include "log.h"
 #include "meme_bitmap.h"
 #include "request.h"
 #include <Wire.h>
-#include <U8g2lib.h>
 #include <FluxGarage_RoboEyes.h>
 
 // Global display objects
-static Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
-// U8g2 for UTF-8 support (same I2C pins, address 0x3C)
-static U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, U8X8_PIN_NONE);
-// RoboEyes instance (template class for Adafruit_SSD1306) - pass by reference
-static RoboEyes<Adafruit_SSD1306> roboEyes(display);
+// The one driver and framebuffer for the panel: GFX primitives, the glyph
+// atlas and the eyes all draw into it. Only the changed column range of
+// each page goes over I2C on display().
+static DirtyPageSSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+// RoboEyes instance (template class for the display type) - pass by reference
+static RoboEyes<DirtyPageSSD1306> roboEyes(display);
 
 // Banner messages for idle screen - motivational quotes
 static const char* bannerMessages[] = {
@@ -39,33 +43,183 @@ static bool scrollInitialized = false;
 static unsigned long scrollPauseStart = 0;
 static const unsigned long SCROLL_PAUSE_DURATION = 2000; // Pause to read the message (2 seconds)
 static int currentBannerDisplayIndex = 0; // Which message is currently being displayed
+static const int16_t BANNER_Y = 54;  // text rows; rows 49-63 below the separator are the banner's
+
+static MonitorRenderStats renderStats = {};
+
+// The messages come pre-rendered from glyph_atlas.h, which the atlas
+// generator builds from the list above
+static_assert(ATLAS_BANNER_COUNT == bannerMessageCount, "banner messages changed, regenerate the atlas");
+static_assert(ATLAS_FRAMEBUFFER_WIDTH == SCREEN_WIDTH, "banner window is one framebuffer row");
+
+// Pixel width of a banner message at text size 1
+static int bannerWidth(int index) {
+  return ATLAS_BANNER_SPANS[index].width;
+}
 
 // Initialize the monitor
 bool monitor_init(int sda_pin, int scl_pin) {
+  uint32_t startUs = micros();
+
   // Initialize I2C
   Wire.begin(sda_pin, scl_pin);
 
   // Initialize Adafruit display
   if(!display.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS)) {
-    Serial.println(F("SSD1306 allocation failed"));
+    LOG_E(LOG_HARDWARE, "SSD1306 allocation failed");
     return false;
   }
 
   // Disable text wrapping to prevent line breaks
   display.setTextWrap(false);
 
-  // Initialize U8g2 (for UTF-8 emoticons)
-  u8g2.begin();
-  u8g2.enableUTF8Print();
+#if MONITOR_ASYNC_FLUSH
+  if (display.beginAsync()) {
+    LOG_I(LOG_HARDWARE, "Display flush task started");
+  }
+#endif
 
-  Serial.println("Monitor initialized successfully");
+  LOG_I(LOG_HARDWARE, "Monitor initialized: one %dx%d framebuffer (%d bytes) in %lu us",
+        SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_WIDTH * SCREEN_HEIGHT / 8,
+        static_cast<unsigned long>(micros() - startUs));
   return true;
 }
 
-// Draw continuous scrolling banner text with transitions
-void monitor_draw_banner(int y) {
-  unsigned long currentTime = millis();
-  display.setTextSize(1);
+// ============================================================================
+// HARDWARE-SCROLLED BANNER
+// ============================================================================
+// Optional ticker mode in which the controller scrolls the banner pages by
+// itself, so nothing goes over I2C while the text moves. The SSD1306 only
+// rotates the 128 columns it holds, so a quote wider than the screen is
+// shown a piece at a time: whole words that fit, centered and held like the
+// software ticker, then carried once around the screen by the controller.
+// When the piece is back in place the firmware stops the scroll and uploads
+// the next piece, or the next quote. Any other change on the screen falls
+// back to the software ticker, which hands over again at its next message
+// boundary.
+
+static const uint8_t BANNER_FIRST_PAGE = BANNER_Y / 8;
+static const uint8_t BANNER_LAST_PAGE = (BANNER_Y + 7) / 8;
+static_assert(BANNER_Y / 8 == 6 && (BANNER_Y + 7) / 8 == 7, "hardware banner scrolls pages 6-7");
+
+// One column every 3 panel frames, close to the software speed. The frame
+// rate cannot be read back over I2C, so a revolution is timed from the
+// nominal 105 Hz that Adafruit_SSD1306::begin()'s clock setting gives. The
+// oscillator is only specified to +/-10 % (333-407 kHz), so when the timer
+// stops the scroll the piece can be up to ~13 columns either side of where
+// it started. That error never carries over: stopping always resends the
+// scrolled pages from the framebuffer, putting the panel RAM back at offset
+// 0 before the next piece (or the software ticker) draws from it.
+static const uint8_t HW_SCROLL_INTERVAL = SSD1306_SCROLL_3_FRAMES;
+static const unsigned long HW_SCROLL_FRAMES = 3;
+static const unsigned long HW_SCROLL_FRAME_HZ = 105;
+static const unsigned long HW_SCROLL_REVOLUTION_MS = SCREEN_WIDTH * HW_SCROLL_FRAMES * 1000 / HW_SCROLL_FRAME_HZ;
+
+// Keep a gap between a piece and its own start coming round again
+static const int HW_PIECE_MAX_WIDTH = SCREEN_WIDTH - 16;
+
+struct HardwareBanner {
+  bool enabled;             // runtime switch
+  bool active;              // the ticker is in hardware mode
+  bool scrolling;           // piece is going round (else held)
+  int message;
+  uint16_t pieceStart;      // columns into the message
+  uint16_t pieceWidth;
+  unsigned long phaseStart;
+};
+
+static HardwareBanner hwBanner = {MONITOR_BANNER_HW_SCROLL != 0, false, false, 0, 0, 0, 0};
+
+// Width of the piece of `message` starting at column `start`: whole words
+// up to HW_PIECE_MAX_WIDTH (a longer word is cut there)
+static uint16_t bannerPieceWidth(int message, uint16_t start) {
+  const char* text = bannerMessages[message] + start / 6;
+  const int maxChars = HW_PIECE_MAX_WIDTH / 6;
+  int fit = 0;
+  int i = 0;
+  for (; text[i] != '\0' && i < maxChars; i++) {
+    if (text[i] == ' ') {
+      fit = i;
+    }
+  }
+  if (text[i] == '\0' || text[i] == ' ' || fit == 0) {
+    fit = i;
+  }
+  return fit * 6;
+}
+
+static void showHardwarePiece(int message, uint16_t start, unsigned long now) {
+  hwBanner.message = message;
+  hwBanner.pieceStart = start;
+  hwBanner.pieceWidth = bannerPieceWidth(message, start);
+  hwBanner.scrolling = false;
+  hwBanner.phaseStart = now;
+}
+
+// Take over from the software ticker as it starts holding `message`
+static void beginHardwareBanner(int message, unsigned long now) {
+  hwBanner.active = true;
+  showHardwarePiece(message, 0, now);
+}
+
+// Hand the ticker back to software, holding the current message
+static void fallBackToSoftwareBanner(unsigned long now) {
+  if (!hwBanner.active) {
+    return;
+  }
+  display.stopScroll();
+  // Undo the rotation now rather than on whatever redraw comes next: every
+  // caller gets here before drawing, so the framebuffer still holds the
+  // idle frame and only the banner pages (invalidated by the stop) go out
+  display.display();
+  hwBanner.active = false;
+  currentBannerDisplayIndex = hwBanner.message;
+  scrollOffset = 0;
+  scrollPauseStart = now;
+  lastScrollUpdate = now;
+}
+
+static void advanceHardwareBanner(unsigned long now) {
+  unsigned long elapsed = now - hwBanner.phaseStart;
+  if (!hwBanner.scrolling) {
+    if (elapsed >= SCROLL_PAUSE_DURATION) {
+      // renderScene() starts the controller once this frame is on the panel
+      hwBanner.scrolling = true;
+      hwBanner.phaseStart = now;
+    }
+    return;
+  }
+  if (elapsed < HW_SCROLL_REVOLUTION_MS) {
+    return;
+  }
+
+  // Back where it started: stop the controller and put up the next piece
+  display.stopScroll();
+  const char* text = bannerMessages[hwBanner.message];
+  uint16_t next = hwBanner.pieceStart + hwBanner.pieceWidth;
+  while (text[next / 6] == ' ') {
+    next += 6;
+  }
+  if (text[next / 6] == '\0') {
+    showHardwarePiece((hwBanner.message + 1) % bannerMessageCount, 0, now);
+  } else {
+    showHardwarePiece(hwBanner.message, next, now);
+  }
+}
+
+// Start the controller scroll if the ticker wants it and it is not running
+static void syncHardwareScroll() {
+  if (hwBanner.active && hwBanner.scrolling && !display.isScrolling()) {
+    display.startScrollLeft(BANNER_FIRST_PAGE, BANNER_LAST_PAGE, HW_SCROLL_INTERVAL);
+  }
+}
+
+// Advance the continuous scrolling banner to `currentTime`
+static void advanceBanner(unsigned long currentTime) {
+  if (hwBanner.active) {
+    advanceHardwareBanner(currentTime);
+    return;
+  }
 
   // Initialize on first call
   if (!scrollInitialized) {
@@ -74,41 +228,20 @@ void monitor_draw_banner(int y) {
     scrollPauseStart = currentTime;
     lastScrollUpdate = currentTime;
     currentBannerDisplayIndex = currentBannerIndex;
+    if (hwBanner.enabled) {
+      beginHardwareBanner(currentBannerDisplayIndex, currentTime);
+    }
+    return;
   }
 
-  const char* currentMessage = bannerMessages[currentBannerDisplayIndex];
-  int nextIndex = (currentBannerDisplayIndex + 1) % bannerMessageCount;
-  const char* nextMessage = bannerMessages[nextIndex];
-
-  // Get text bounds for current message
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.getTextBounds(currentMessage, 0, 0, &x1, &y1, &w, &h);
-  int currentMessageWidth = w;
-
-  // Get text bounds for next message
-  display.getTextBounds(nextMessage, 0, 0, &x1, &y1, &w, &h);
-  int nextMessageWidth = w;
-
   // Handle pause at the beginning
   if (scrollPauseStart > 0) {
-    if (currentTime - scrollPauseStart >= SCROLL_PAUSE_DURATION) {
-      // Pause is over, start scrolling
-      scrollPauseStart = 0;
-      lastScrollUpdate = currentTime;
-    } else {
-      // Still in pause, display message statically
-      if (currentMessageWidth <= SCREEN_WIDTH) {
-        // Center short messages
-        int centerX = (SCREEN_WIDTH - currentMessageWidth) / 2;
-        display.setCursor(centerX, y);
-      } else {
-        // Long messages start from left
-        display.setCursor(0, y);
-      }
-      display.print(currentMessage);
+    if (currentTime - scrollPauseStart < SCROLL_PAUSE_DURATION) {
       return;
     }
+    // Pause is over, start scrolling
+    scrollPauseStart = 0;
+    lastScrollUpdate = currentTime;
   }
 
   // Update scroll offset
@@ -117,164 +250,331 @@ void monitor_draw_banner(int y) {
     lastScrollUpdate = currentTime;
   }
 
-  // Calculate total transition width (current message scrolls out, next slides in)
-  int totalTransitionWidth = currentMessageWidth + SCREEN_WIDTH + nextMessageWidth;
-
-  // Check if we've completed the full transition
+  // Check if we've completed the full transition (current message scrolls
+  // out, next slides in); then hold the next message
+  int nextIndex = (currentBannerDisplayIndex + 1) % bannerMessageCount;
+  int totalTransitionWidth = bannerWidth(currentBannerDisplayIndex) + SCREEN_WIDTH + bannerWidth(nextIndex);
   if (scrollOffset >= totalTransitionWidth) {
-    // Move to next message
     currentBannerDisplayIndex = nextIndex;
     scrollOffset = 0;
     scrollPauseStart = currentTime;
     lastScrollUpdate = currentTime;
-    return;
+    if (hwBanner.enabled) {
+      beginHardwareBanner(currentBannerDisplayIndex, currentTime);
+    }
   }
+}
 
-  // Draw the scrolling transition
-  // Current message scrolls from left to off-screen left
-  int currentX = -scrollOffset;
+// What the banner shows: the message and, while scrolling, the offset
+// (-1 while the message is held). Hardware mode keys are negative: the
+// message, the piece and whether the controller is moving it.
+static int32_t bannerFrameKey() {
+  if (hwBanner.active) {
+    return -(hwBanner.message * 2048 + hwBanner.pieceStart * 2 + (hwBanner.scrolling ? 1 : 0)) - 1;
+  }
+  int32_t offset = scrollPauseStart > 0 ? -1 : scrollOffset;
+  return currentBannerDisplayIndex * 65536 + offset + 1;
+}
+
+// Copy the strip columns offset..offset+width-1 that land in the window
+// when they start at column x
+static void placeBannerColumns(uint8_t* window, int x, uint16_t offset, int width) {
+  int first = x < 0 ? -x : 0;
+  int last = x + width > SCREEN_WIDTH ? SCREEN_WIDTH - x : width;
+  if (first < last) {
+    memcpy(window + x + first, ATLAS_BANNER_STRIP + offset + first, last - first);
+  }
+}
 
-  // Next message appears from right when current message width + spacing has scrolled
-  int nextX = currentMessageWidth + SCREEN_WIDTH - scrollOffset;
+static void placeBannerMessage(uint8_t* window, int x, int index) {
+  placeBannerColumns(window, x, ATLAS_BANNER_SPANS[index].offset, ATLAS_BANNER_SPANS[index].width);
+}
 
-  // Draw current message if still visible
-  if (currentX + currentMessageWidth > 0) {
-    display.setCursor(currentX, y);
-    display.print(currentMessage);
+// Draw the banner as advanceBanner() left it: the visible window of the
+// pre-rendered messages replaces text rows y..y+7 in one pass
+static void drawBanner(int y) {
+  uint32_t startUs = micros();
+  uint8_t window[SCREEN_WIDTH];
+  memset(window, 0, sizeof(window));
+
+  int currentMessageWidth = bannerWidth(currentBannerDisplayIndex);
+  if (hwBanner.active) {
+    // The piece centered; the controller does any moving
+    placeBannerColumns(window, (SCREEN_WIDTH - hwBanner.pieceWidth) / 2,
+                       ATLAS_BANNER_SPANS[hwBanner.message].offset + hwBanner.pieceStart, hwBanner.pieceWidth);
+  } else if (scrollPauseStart > 0) {
+    // Held: center short messages, long messages start from left
+    int x = currentMessageWidth <= SCREEN_WIDTH ? (SCREEN_WIDTH - currentMessageWidth) / 2 : 0;
+    placeBannerMessage(window, x, currentBannerDisplayIndex);
+  } else {
+    // Current message scrolls out to the left; the next one follows a
+    // screen width behind it
+    int nextIndex = (currentBannerDisplayIndex + 1) % bannerMessageCount;
+    placeBannerMessage(window, -scrollOffset, currentBannerDisplayIndex);
+    placeBannerMessage(window, currentMessageWidth + SCREEN_WIDTH - scrollOffset, nextIndex);
   }
+  atlas_copy_rows(display.getBuffer(), y, window);
 
-  // Draw next message if it has started appearing
-  if (nextX < SCREEN_WIDTH) {
-    display.setCursor(nextX, y);
-    display.print(nextMessage);
+  renderStats.bannerDraws++;
+  renderStats.bannerUs += micros() - startUs;
+}
+
+// ============================================================================
+// RETAINED IDLE / RUNNING SCREEN
+// ============================================================================
+// The idle and running screens share one layout: static chrome (separator
+// lines, the "Completed:" label) around a few widgets. The framebuffer
+// keeps the last frame and `scene` records what each widget shows; an
+// update clears and redraws only the widgets whose value changed and skips
+// the flush when none did. Any other screen or the eyes overwrite the
+// framebuffer, so they drop the scene and the next update composes it
+// from scratch.
+
+enum SceneLayout : uint8_t {
+  SCENE_NONE,     // framebuffer holds something else
+  SCENE_IDLE,     // banner footer
+  SCENE_RUNNING   // completed-count footer
+};
+
+enum SceneTab : uint8_t {
+  TAB_NONE,
+  TAB_WORK,
+  TAB_BREAK
+};
+
+struct SceneState {
+  SceneLayout layout;
+  SceneTab tab;
+  char timer[FORMAT_TIME_SIZE];
+  bool paused;
+  int completed;       // running footer
+  int32_t bannerKey;   // idle footer, see bannerFrameKey()
+};
+
+struct SceneRect {
+  int16_t x, y, w, h;
+};
+
+// Widget areas; each is cleared before its widget is redrawn. The timer
+// digits are one widget per character cell.
+static const SceneRect TABS_AREA = {0, 0, SCREEN_WIDTH, 13};
+static const SceneRect TIMER_AREA = {15, ATLAS_TIMER_Y, SCREEN_WIDTH - 15, 24};  // digits and pause mark
+static const int16_t TIMER_CELL_WIDTH = ATLAS_TIMER_CELL_WIDTH;  // size 3 glyph advance
+
+// The labels and digits come pre-rendered from glyph_atlas.h for these rows
+static_assert(ATLAS_LABEL_WORK_Y == 2 && ATLAS_LABEL_BREAK_Y == 2, "tab labels moved, regenerate the atlas");
+static_assert(ATLAS_LABEL_COMPLETED_Y == 52, "count label moved, regenerate the atlas");
+static const SceneRect COUNT_AREA = {85, 52, SCREEN_WIDTH - 85, 8};
+
+static SceneState scene = {};
+
+static void dropScene() {
+  fallBackToSoftwareBanner(millis());
+  scene.layout = SCENE_NONE;
+}
+
+static void clearArea(const SceneRect& area) {
+  display.fillRect(area.x, area.y, area.w, area.h, SSD1306_BLACK);
+}
+
+static void drawChrome(SceneLayout layout) {
+  display.drawLine(0, 14, 127, 14, SSD1306_WHITE);
+  display.drawLine(0, 48, 127, 48, SSD1306_WHITE);
+  if (layout == SCENE_RUNNING) {
+    atlas_draw(display.getBuffer(), 0, ATLAS_LABEL_COMPLETED, false);
   }
 }
 
-// Show boot screen
-void monitor_show_boot_screen() {
-  display.clearDisplay();
-  display.setTextSize(2);
-  display.setTextColor(SSD1306_WHITE);
-  display.setCursor(0, 10);
-  display.println("Pomodoro");
-  display.println("Timer");
-  display.display();
+// WORK and BREAK labels, the active one inverted
+static void drawTabs(SceneTab tab) {
+  if (tab == TAB_WORK) {
+    display.fillRect(8, 0, 40, 12, SSD1306_WHITE);
+  }
+  atlas_draw(display.getBuffer(), 10, ATLAS_LABEL_WORK, tab == TAB_WORK);
+
+  if (tab == TAB_BREAK) {
+    display.fillRect(68, 0, 50, 12, SSD1306_WHITE);
+  }
+  atlas_draw(display.getBuffer(), 70, ATLAS_LABEL_BREAK, tab == TAB_BREAK);
 }
 
-// Show idle screen
-void monitor_show_idle_screen(IdleMode selectedMode, int completedCount) {
-  display.clearDisplay();
+static void drawPauseMark() {
+  display.setTextColor(SSD1306_WHITE);
   display.setTextSize(1);
+  display.setCursor(95, 30);
+  display.print("||");
+}
 
-  // Top section - Mode selection
-  // WORK text
-  display.setCursor(10, 2);
-  if (selectedMode == MODE_WORK) {
-    // Inverted for selected
-    display.fillRect(8, 0, 40, 12, SSD1306_WHITE);
-    display.setTextColor(SSD1306_BLACK);
-    display.println("WORK");
-  } else {
+static void drawTimer(const char* text, bool paused) {
+  if (!atlas_draw_timer(display.getBuffer(), TIMER_AREA.x, text)) {
     display.setTextColor(SSD1306_WHITE);
-    display.println("WORK");
+    display.setTextSize(3);
+    display.setCursor(TIMER_AREA.x, TIMER_AREA.y);
+    display.print(text);
+  }
+  if (paused) {
+    drawPauseMark();
   }
+}
 
-  // BREAK text
+// Redraw only the character cells that differ from `before`; returns the
+// number of cells drawn
+static uint32_t updateTimerCells(const char* before, const char* text, bool paused) {
+  uint32_t drawn = 0;
+  bool markTouched = false;
   display.setTextColor(SSD1306_WHITE);
-  display.setCursor(70, 2);
-  if (selectedMode == MODE_BREAK) {
-    // Inverted for selected
-    display.fillRect(68, 0, 50, 12, SSD1306_WHITE);
-    display.setTextColor(SSD1306_BLACK);
-    display.println("BREAK");
-  } else {
-    display.setTextColor(SSD1306_WHITE);
-    display.println("BREAK");
+  for (int i = 0; text[i] != '\0'; i++) {
+    if (text[i] == before[i]) {
+      continue;
+    }
+    int16_t x = TIMER_AREA.x + i * TIMER_CELL_WIDTH;
+    const AtlasBitmap* glyph = atlas_timer_glyph(text[i]);
+    if (glyph != nullptr) {
+      atlas_copy(display.getBuffer(), x, *glyph, ATLAS_TIMER_PAGE_MASKS);  // clears the cell too
+    } else {
+      display.fillRect(x, TIMER_AREA.y, TIMER_CELL_WIDTH, TIMER_AREA.h, SSD1306_BLACK);
+      display.setTextSize(3);
+      display.setCursor(x, TIMER_AREA.y);
+      display.write(static_cast<uint8_t>(text[i]));
+    }
+    markTouched = markTouched || x + TIMER_CELL_WIDTH > 95;
+    drawn++;
+  }
+  if (paused && markTouched) {
+    drawPauseMark();
   }
+  return drawn;
+}
 
+static void drawCount(int completed) {
   display.setTextColor(SSD1306_WHITE);
-  display.drawLine(0, 14, 127, 14, SSD1306_WHITE);
+  display.setTextSize(1);
+  display.setCursor(85, 52);
+  display.print(completed);
+}
 
-  // Timer section - show 00:00
-  display.setTextSize(3);
-  display.setCursor(15, 22);
-  display.println("00:00");
+// Bring the framebuffer from `scene` to `next` and flush if anything changed
+static void renderScene(const SceneState& next) {
+  uint32_t startUs = micros();
+  renderStats.updates++;
 
-  display.drawLine(0, 48, 127, 48, SSD1306_WHITE);
+  bool compose = scene.layout != next.layout;
+  if (compose) {
+    display.clearDisplay();
+    drawChrome(next.layout);
+    renderStats.composed++;
+  }
 
-  // Bottom section - Static banner message with quotes
-  display.setTextSize(1);
-  display.setTextColor(SSD1306_WHITE);
-  // Center text vertically in banner area (48-64 = 16px height, text is 8px)
-  // y = 48 + (16-8)/2 = 48 + 4 = 52, but adjust to 54 for better visual centering
-  monitor_draw_banner(54);
+  uint32_t drawn = 0;
+  if (compose || next.tab != scene.tab) {
+    if (!compose) clearArea(TABS_AREA);
+    drawTabs(next.tab);
+    drawn++;
+  }
+  if (compose || next.paused != scene.paused || strlen(next.timer) != strlen(scene.timer)) {
+    if (!compose) clearArea(TIMER_AREA);
+    drawTimer(next.timer, next.paused);
+    drawn++;
+  } else {
+    drawn += updateTimerCells(scene.timer, next.timer, next.paused);
+  }
+  if (next.layout == SCENE_IDLE) {
+    if (compose || next.bannerKey != scene.bannerKey) {
+      drawBanner(BANNER_Y);  // replaces its rows, no clear needed
+      drawn++;
+    }
+  } else if (compose || next.completed != scene.completed) {
+    if (!compose) clearArea(COUNT_AREA);
+    drawCount(next.completed);
+    drawn++;
+  }
 
+  scene = next;
+  if (drawn == 0) {
+    return;  // the panel already shows this frame
+  }
+  renderStats.rasterized++;
+  renderStats.widgetsDrawn += drawn;
+  renderStats.rasterUs += micros() - startUs;
   display.display();
+  if (next.layout == SCENE_IDLE) {
+    syncHardwareScroll();
+  }
+}
+
+// Show idle screen
+void monitor_show_idle_screen(IdleMode selectedMode, int completedCount) {
+  monitor_animation_stop();
+  unsigned long now = millis();
+
+  SceneState next = {};
+  next.layout = SCENE_IDLE;
+  next.tab = selectedMode == MODE_WORK ? TAB_WORK : TAB_BREAK;
+  format_time(next.timer, sizeof(next.timer), 0);
+  // Anything but the banner to redraw: the panel RAM has to be written
+  if (next.layout != scene.layout || next.tab != scene.tab || strcmp(next.timer, scene.timer) != 0 ||
+      next.paused != scene.paused) {
+    fallBackToSoftwareBanner(now);
+  }
+  advanceBanner(now);
+  next.bannerKey = bannerFrameKey();
+  renderScene(next);
 }
 
 // Show running screen
 void monitor_show_running_screen(PomodoroState state, unsigned long timeRemaining, int completedCount) {
-  display.clearDisplay();
-  display.setTextSize(1);
-  display.setTextColor(SSD1306_WHITE);
+  monitor_animation_stop();
+  fallBackToSoftwareBanner(millis());
 
-  // Top section - Mode display
-  // WORK text
-  display.setCursor(10, 2);
+  SceneState next = {};
+  next.layout = SCENE_RUNNING;
   if (state == POMODORO_WORK) {
-    // Inverted for active
-    display.fillRect(8, 0, 40, 12, SSD1306_WHITE);
-    display.setTextColor(SSD1306_BLACK);
-    display.println("WORK");
-  } else {
-    display.setTextColor(SSD1306_WHITE);
-    display.println("WORK");
-  }
-
-  // BREAK text
-  display.setTextColor(SSD1306_WHITE);
-  display.setCursor(70, 2);
-  if (state == POMODORO_SHORT_BREAK || state == POMODORO_LONG_BREAK) {
-    // Inverted for active
-    display.fillRect(68, 0, 50, 12, SSD1306_WHITE);
-    display.setTextColor(SSD1306_BLACK);
-    display.println("BREAK");
-  } else {
-    display.setTextColor(SSD1306_WHITE);
-    display.println("BREAK");
+    next.tab = TAB_WORK;
+  } else if (state == POMODORO_SHORT_BREAK || state == POMODORO_LONG_BREAK) {
+    next.tab = TAB_BREAK;
   }
+  format_time(next.timer, sizeof(next.timer), timeRemaining);
+  next.paused = state == POMODORO_PAUSED;
+  next.completed = completedCount;
+  renderScene(next);
+}
 
-  display.setTextColor(SSD1306_WHITE);
-  display.drawLine(0, 14, 127, 14, SSD1306_WHITE);
-
-  // Timer section
-  display.setTextSize(3);
-  display.setCursor(15, 22);
-  String timeStr = monitor_format_time(timeRemaining);
-  display.println(timeStr);
+const char* monitor_get_banner_message(int index) {
+  return index >= 0 && index < bannerMessageCount ? bannerMessages[index] : nullptr;
+}
 
-  // Show paused indicator if paused
-  if (state == POMODORO_PAUSED) {
-    display.setTextSize(1);
-    display.setCursor(95, 30);
-    display.println("||");
+void monitor_set_banner_hardware_scroll(bool enabled) {
+  hwBanner.enabled = enabled;
+  if (!enabled) {
+    fallBackToSoftwareBanner(millis());
   }
+}
 
-  display.drawLine(0, 48, 127, 48, SSD1306_WHITE);
+bool monitor_banner_hardware_scroll_active() {
+  return hwBanner.active && display.isScrolling();
+}
 
-  // Bottom section - Completed rounds
-  display.setTextSize(1);
-  display.setCursor(0, 52);
-  display.print("Completed: ");
-  display.setTextSize(1);
-  display.setCursor(85, 52);
-  display.print(completedCount);
+MonitorRenderStats monitor_get_render_stats() {
+  return renderStats;
+}
 
+// Show boot screen
+void monitor_show_boot_screen() {
+  monitor_animation_stop();
+  dropScene();
+  display.clearDisplay();
+  display.setTextSize(2);
+  display.setTextColor(SSD1306_WHITE);
+  display.setCursor(0, 10);
+  display.println("Pomodoro");
+  display.println("Timer");
   display.display();
 }
 
 // Show finished screen
 void monitor_show_finished_screen(int completedCount) {
+  monitor_animation_stop();
+  dropScene();
   display.clearDisplay();
   display.setTextSize(2);
   display.setTextColor(SSD1306_WHITE);
@@ -293,23 +593,45 @@ void monitor_show_finished_screen(int completedCount) {
   display.display();
 }
 
-// Format time as MM:SS
-String monitor_format_time(unsigned long seconds) {
-  unsigned long minutes = seconds / 60;
-  unsigned long secs = seconds % 60;
+// I2C traffic sent to the display so far
+DisplayFlushStats monitor_get_flush_stats() {
+  return display.stats();
+}
 
-  String timeStr = "";
-  if (minutes < 10) timeStr += "0";
-  timeStr += String(minutes);
-  timeStr += ":";
-  if (secs < 10) timeStr += "0";
-  timeStr += String(secs);
+void monitor_set_async_flush(bool enabled) {
+  display.setAsync(enabled);
+}
 
-  return timeStr;
+void monitor_wait_for_flush() {
+  display.waitForFlush();
+}
+
+unsigned long monitor_banner_ms_until_change(unsigned long now) {
+  if (!scrollInitialized) {
+    return 0;
+  }
+  // Hardware mode: the next piece, or the start of the controller scroll
+  if (hwBanner.active) {
+    unsigned long phase = hwBanner.scrolling ? HW_SCROLL_REVOLUTION_MS : SCROLL_PAUSE_DURATION;
+    if (hwBanner.scrolling && !display.isScrolling()) {
+      return 0;
+    }
+    unsigned long elapsed = now - hwBanner.phaseStart;
+    return elapsed >= phase ? 0 : phase - elapsed;
+  }
+  // Holding a message: nothing moves until the pause is over
+  if (scrollPauseStart > 0) {
+    unsigned long paused = now - scrollPauseStart;
+    return paused >= SCROLL_PAUSE_DURATION ? 0 : SCROLL_PAUSE_DURATION - paused;
+  }
+  unsigned long sinceStep = now - lastScrollUpdate;
+  return sinceStep >= SCROLL_DELAY ? 0 : SCROLL_DELAY - sinceStep;
 }
 
 // Show meme image
 void monitor_show_meme() {
+  monitor_animation_stop();
+  dropScene();
   display.clearDisplay();
   display.drawBitmap(0, 0, meme_bitmap, MEME_WIDTH, MEME_HEIGHT, SSD1306_WHITE);
   display.display();
@@ -334,6 +656,7 @@ void monitor_roboeyes_show_sad() {
 void monitor_roboeyes_animate(int duration_ms) {
   unsigned long startTime = millis();
 
+  dropScene();
   while (millis() - startTime < duration_ms) {
     display.clearDisplay();
     roboEyes.update();  // This calls drawEyes() internally
@@ -342,340 +665,204 @@ void monitor_roboeyes_animate(int duration_ms) {
   }
 }
 
-// Show init expression - eyes look left and right
-void monitor_roboeyes_show_init() {
-  roboEyes.setMood(DEFAULT);
-  roboEyes.setCuriosity(true);  // Makes outer eye larger when looking sideways
-  
-  // Animate looking left and right
-  unsigned long startTime = millis();
-  int lookDuration = 1000;  // Look each direction for 1 second
-  
-  // Look left
-  roboEyes.setPosition(W);  // West - look left
-  while (millis() - startTime < lookDuration) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(50);
-  }
-  
-  // Look center briefly
-  startTime = millis();
-  roboEyes.setPosition(DEFAULT);  // Center
-  while (millis() - startTime < 500) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(50);
-  }
-  
-  // Look right
-  startTime = millis();
-  roboEyes.setPosition(E);  // East - look right
-  while (millis() - startTime < lookDuration) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(50);
-  }
-  
-  // Return to center
-  roboEyes.setPosition(DEFAULT);
-  roboEyes.setCuriosity(false);
-
-  // Trigger blink
-  roboEyes.blink();
-
-  // Quick blink animation (shorter duration to transition faster)
-  startTime = millis();
-  while (millis() - startTime < 50) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(50);
-  }
-
-  // Transition to happy mood immediately after blink
-  roboEyes.setMood(HAPPY);
-
-  // Typing animation for "Happy Learning!" text
-  const char* message = "Happy Learning!";
-  int messageLen = strlen(message);
-  int textY = 52; // Position slightly higher from bottom
-
-  display.setTextSize(1);
-
-  // Calculate center position for the full text
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.getTextBounds(message, 0, 0, &x1, &y1, &w, &h);
-  int centerX = (SCREEN_WIDTH - w) / 2;
-
-  // Typing effect - reveal one character at a time
-  int charDelay = 80; // Delay between each character (ms)
-
-  for (int i = 0; i <= messageLen; i++) {
-    display.clearDisplay();
-    roboEyes.update();
-
-    // Draw the text up to current character
-    display.setTextColor(SSD1306_WHITE);
-    display.setCursor(centerX, textY);
-
-    for (int j = 0; j < i; j++) {
-      display.print(message[j]);
-    }
-
-    display.display();
-    delay(charDelay);
-  }
-  delay(1000); // Hold the final message for a moment
-}
+// ============================================================================
+// KEYFRAME ANIMATIONS
+// ============================================================================
+// Each RoboEyes sequence is a static table of keyframes. Starting a sequence
+// only loads the table; monitor_animation_update() renders at most one frame
+// per call, so loop() keeps servicing buttons, the timer and the sensors
+// while the eyes move.
+
+static const unsigned long ANIMATION_FRAME_INTERVAL = 50; // ~20fps
+static const int ANIMATION_TEXT_Y = 52;
+
+struct EyeKeyframe {
+  uint16_t durationMs;  // 0 = as long as it takes to type the caption
+  uint8_t mood;         // DEFAULT, HAPPY or TIRED
+  uint8_t position;     // DEFAULT or a compass direction
+  bool curious;
+  bool blink;           // trigger a blink when the keyframe starts
+  const char* caption;  // centered text at the bottom, nullptr for none
+  uint8_t charDelayMs;  // typewriter speed, 0 = caption shown at once
+};
 
-// Show lost expression - searching eyes then sad with "Where are you?"
-void monitor_roboeyes_show_lost() {
-  roboEyes.setMood(DEFAULT);
-  roboEyes.setCuriosity(true);  // Makes outer eye larger when looking
+// Eyes look left and right, blink, then greet
+static const EyeKeyframe initSequence[] = {
+  {1000, DEFAULT, W, true, false, nullptr, 0},
+  {500, DEFAULT, DEFAULT, true, false, nullptr, 0},
+  {1000, DEFAULT, E, true, false, nullptr, 0},
+  {50, DEFAULT, DEFAULT, false, true, nullptr, 0},
+  {0, HAPPY, DEFAULT, false, false, "Happy Learning!", 80},
+  {1000, HAPPY, DEFAULT, false, false, "Happy Learning!", 0},
+};
 
-  // Searching animation - look around in different directions
-  unsigned long startTime = millis();
-  int lookDuration = 600;  // Look each direction for 600ms
+// Searching eyes, then sad with "Where are you?"
+static const EyeKeyframe lostSequence[] = {
+  {600, DEFAULT, W, true, false, nullptr, 0},
+  {600, DEFAULT, E, true, false, nullptr, 0},
+  {600, DEFAULT, N, true, false, nullptr, 0},
+  {600, DEFAULT, S, true, false, nullptr, 0},
+  {0, TIRED, DEFAULT, false, false, "Where are you?", 80},
+  {2000, TIRED, DEFAULT, false, false, "Where are you?", 0},
+};
 
-  // Look left
-  roboEyes.setPosition(W);  // West - look left
-  while (millis() - startTime < lookDuration) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(50);
-  }
+// Sad, blink, then happy with "You are Back!"
+static const EyeKeyframe returnSequence[] = {
+  {1000, TIRED, DEFAULT, false, false, nullptr, 0},
+  {300, TIRED, DEFAULT, false, true, nullptr, 0},
+  {0, HAPPY, DEFAULT, false, false, "You are Back!", 80},
+  {2000, HAPPY, DEFAULT, false, false, "You are Back!", 0},
+};
 
-  // Look right
-  startTime = millis();
-  roboEyes.setPosition(E);  // East - look right
-  while (millis() - startTime < lookDuration) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(50);
+// Rapid eye movements with "Shake Shake!"
+#define SHAKE_KEYFRAMES {100, HAPPY, W, true, false, nullptr, 0}, {100, HAPPY, E, true, false, nullptr, 0}
+static const EyeKeyframe shakeSequence[] = {
+  SHAKE_KEYFRAMES, SHAKE_KEYFRAMES, SHAKE_KEYFRAMES, SHAKE_KEYFRAMES,
+  SHAKE_KEYFRAMES, SHAKE_KEYFRAMES, SHAKE_KEYFRAMES, SHAKE_KEYFRAMES,
+  {200, HAPPY, DEFAULT, false, true, nullptr, 0},
+  {0, HAPPY, DEFAULT, false, false, "Shake Shake!", 60},
+  {1500, HAPPY, DEFAULT, false, false, "Shake Shake!", 0},
+};
+#undef SHAKE_KEYFRAMES
+
+// Player state
+static const EyeKeyframe* animationFrames = nullptr;
+static int animationFrameCount = 0;
+static int animationIndex = 0;
+static unsigned long keyframeStart = 0;
+static unsigned long keyframeDuration = 0;
+static unsigned long lastAnimationFrame = 0;
+static int captionX = 0;
+static int captionLength = 0;
+
+// Apply the state of the current keyframe to the eyes
+static void enterKeyframe(unsigned long now) {
+  const EyeKeyframe& frame = animationFrames[animationIndex];
+
+  roboEyes.setMood(frame.mood);
+  roboEyes.setPosition(frame.position);
+  roboEyes.setCuriosity(frame.curious);
+  if (frame.blink) {
+    roboEyes.blink();
   }
 
-  // Look up
-  startTime = millis();
-  roboEyes.setPosition(N);  // North - look up
-  while (millis() - startTime < lookDuration) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(50);
+  captionLength = 0;
+  if (frame.caption != nullptr) {
+    int16_t x1, y1;
+    uint16_t w, h;
+    display.setTextSize(1);
+    display.getTextBounds(frame.caption, 0, 0, &x1, &y1, &w, &h);
+    captionX = (SCREEN_WIDTH - w) / 2;
+    captionLength = strlen(frame.caption);
   }
 
-  // Look down
-  startTime = millis();
-  roboEyes.setPosition(S);  // South - look down
-  while (millis() - startTime < lookDuration) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(50);
+  keyframeDuration = frame.durationMs;
+  if (keyframeDuration == 0) {
+    // One step per character plus the empty first step
+    keyframeDuration = static_cast<unsigned long>(captionLength + 1) * frame.charDelayMs;
   }
+  keyframeStart = now;
+}
 
-  // Return to center and turn off curiosity
-  roboEyes.setPosition(DEFAULT);
-  roboEyes.setCuriosity(false);
-
-  // Switch to sad mood
-  roboEyes.setMood(TIRED);  // TIRED for sad look
-
-  // Display sad eyes with message
-  const char* message = "Where are you?";
-  int messageLen = strlen(message);
-  int textY = 52;
-
-  display.setTextSize(1);
-
-  // Calculate center position for the text
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.getTextBounds(message, 0, 0, &x1, &y1, &w, &h);
-  int centerX = (SCREEN_WIDTH - w) / 2;
-
-  // Typing effect - reveal one character at a time
-  int charDelay = 80; // Delay between each character (ms)
-
-  for (int i = 0; i <= messageLen; i++) {
-    display.clearDisplay();
-    roboEyes.update();
+static void startSequence(const EyeKeyframe* frames, int count) {
+  animationFrames = frames;
+  animationFrameCount = count;
+  animationIndex = 0;
+  // Render the first frame on the next update
+  lastAnimationFrame = millis() - ANIMATION_FRAME_INTERVAL;
+  enterKeyframe(millis());
+}
 
-    // Draw the text up to current character
-    display.setTextColor(SSD1306_WHITE);
-    display.setCursor(centerX, textY);
+// Draw the eyes plus the (partially typed) caption of the current keyframe
+static void renderAnimationFrame(unsigned long now) {
+  const EyeKeyframe& frame = animationFrames[animationIndex];
 
-    for (int j = 0; j < i; j++) {
-      display.print(message[j]);
+  dropScene();
+  display.clearDisplay();
+  roboEyes.update();
+
+  if (frame.caption != nullptr) {
+    int visible = captionLength;
+    if (frame.charDelayMs > 0) {
+      visible = (now - keyframeStart) / frame.charDelayMs;
+      if (visible > captionLength) {
+        visible = captionLength;
+      }
     }
 
-    display.display();
-    delay(charDelay);
+    display.setTextSize(1);
+    display.setTextColor(SSD1306_WHITE);
+    display.setCursor(captionX, ANIMATION_TEXT_Y);
+    display.write(reinterpret_cast<const uint8_t*>(frame.caption), visible);
   }
 
-  delay(2000); // Hold the final message for 2 seconds
+  display.display();
 }
 
-// Show return expression - sad, blink, then happy with "You are Back!"
-void monitor_roboeyes_show_return() {
-  // Start with sad mood
-  roboEyes.setMood(TIRED);  // TIRED for sad look
-  roboEyes.setPosition(DEFAULT);  // Center position
-
-  // Show sad eyes for a moment
-  unsigned long startTime = millis();
-  while (millis() - startTime < 1000) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(100);
-  }
-
-  // Trigger blink
-  roboEyes.blink();
-
-  // Blink animation
-  startTime = millis();
-  while (millis() - startTime < 300) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(50);
+// Advance the running sequence; returns true while it is still playing
+bool monitor_animation_update() {
+  if (animationFrames == nullptr) {
+    return false;
   }
 
-  // Transition to happy mood
-  roboEyes.setMood(HAPPY);
-
-  // Display happy eyes with message
-  const char* message = "You are Back!";
-  int messageLen = strlen(message);
-  int textY = 52;
-
-  display.setTextSize(1);
-
-  // Calculate center position for the text
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.getTextBounds(message, 0, 0, &x1, &y1, &w, &h);
-  int centerX = (SCREEN_WIDTH - w) / 2;
-
-  // Typing effect - reveal one character at a time
-  int charDelay = 80; // Delay between each character (ms)
+  unsigned long now = millis();
 
-  for (int i = 0; i <= messageLen; i++) {
-    display.clearDisplay();
-    roboEyes.update();
-
-    // Draw the text up to current character
-    display.setTextColor(SSD1306_WHITE);
-    display.setCursor(centerX, textY);
-
-    for (int j = 0; j < i; j++) {
-      display.print(message[j]);
+  // Skip keyframes whose time has passed (absolute timing, so a slow loop
+  // shortens frames rather than stretching the sequence)
+  while (now - keyframeStart >= keyframeDuration) {
+    unsigned long nextStart = keyframeStart + keyframeDuration;
+    animationIndex++;
+    if (animationIndex >= animationFrameCount) {
+      animationFrames = nullptr;
+      return false;
     }
-
-    display.display();
-    delay(charDelay);
+    enterKeyframe(nextStart);
   }
 
-  delay(2000); // Hold the final message for 2 seconds
+  if (now - lastAnimationFrame >= ANIMATION_FRAME_INTERVAL) {
+    lastAnimationFrame = now;
+    renderAnimationFrame(now);
+  }
+  return true;
 }
 
-// Show shake expression - rapid eye movements with "Shake Shake!"
-void monitor_roboeyes_show_shake() {
-  roboEyes.setMood(HAPPY);  // Happy/excited mood
-  roboEyes.setCuriosity(true);  // Makes eyes more expressive
-
-  // Rapid shaking animation - quick movements back and forth
-  unsigned long startTime = millis();
-  int shakeDuration = 100;  // Very quick movements for shake effect
-  int totalShakes = 8;  // Number of shake cycles
-
-  for (int shake = 0; shake < totalShakes; shake++) {
-    // Quick left
-    startTime = millis();
-    roboEyes.setPosition(W);  // West - look left
-    while (millis() - startTime < shakeDuration) {
-      display.clearDisplay();
-      roboEyes.update();
-      display.display();
-      delay(50);
-    }
+bool monitor_animation_is_active() {
+  return animationFrames != nullptr;
+}
 
-    // Quick right
-    startTime = millis();
-    roboEyes.setPosition(E);  // East - look right
-    while (millis() - startTime < shakeDuration) {
-      display.clearDisplay();
-      roboEyes.update();
-      display.display();
-      delay(50);
-    }
+void monitor_animation_stop() {
+  if (animationFrames == nullptr) {
+    return;
   }
-
-  // Return to center
+  animationFrames = nullptr;
   roboEyes.setPosition(DEFAULT);
   roboEyes.setCuriosity(false);
+}
 
-  // Blink for excitement
-  roboEyes.blink();
-
-  // Quick blink animation
-  startTime = millis();
-  while (millis() - startTime < 200) {
-    display.clearDisplay();
-    roboEyes.update();
-    display.display();
-    delay(50);
-  }
-
-  // Keep happy mood
-  roboEyes.setMood(HAPPY);
-
-  // Display excited eyes with message
-  const char* message = "Shake Shake!";
-  int messageLen = strlen(message);
-  int textY = 52;
-
-  display.setTextSize(1);
-
-  // Calculate center position for the text
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.getTextBounds(message, 0, 0, &x1, &y1, &w, &h);
-  int centerX = (SCREEN_WIDTH - w) / 2;
-
-  // Typing effect - reveal one character at a time
-  int charDelay = 60; // Faster typing for excitement
-
-  for (int i = 0; i <= messageLen; i++) {
-    display.clearDisplay();
-    roboEyes.update();
-
-    // Draw the text up to current character
-    display.setTextColor(SSD1306_WHITE);
-    display.setCursor(centerX, textY);
+// Show init expression - eyes look left and right
+void monitor_roboeyes_show_init() {
+  startSequence(initSequence, sizeof(initSequence) / sizeof(initSequence[0]));
+}
 
-    for (int j = 0; j < i; j++) {
-      display.print(message[j]);
-    }
+// Show lost expression - searching eyes then sad with "Where are you?"
+void monitor_roboeyes_show_lost() {
+  startSequence(lostSequence, sizeof(lostSequence) / sizeof(lostSequence[0]));
+}
 
-    display.display();
-    delay(charDelay);
-  }
+// Show return expression - sad, blink, then happy with "You are Back!"
+void monitor_roboeyes_show_return() {
+  startSequence(returnSequence, sizeof(returnSequence) / sizeof(returnSequence[0]));
+}
 
-  delay(1500); // Hold the final message for 1.5 seconds
+// Show shake expression - rapid eye movements with "Shake Shake!"
+void monitor_roboeyes_show_shake() {
+  startSequence(shakeSequence, sizeof(shakeSequence) / sizeof(shakeSequence[0]));
 }
 
 // Show gambling intro screen
 void monitor_gambling_show_intro() {
+  monitor_animation_stop();
+  dropScene();
   display.clearDisplay();
   display.setTextColor(SSD1306_WHITE);
 
@@ -700,6 +887,8 @@ void monitor_gambling_show_intro() {
 
 // Show gambling result screen
 void monitor_gambling_show_result(GamblingChoice choice, bool win) {
+  monitor_animation_stop();
+  dropScene();
   display.clearDisplay();
   display.setTextColor(SSD1306_WHITE);
 
@@ -730,6 +919,8 @@ void monitor_gambling_show_result(GamblingChoice choice, bool win) {
 
 // Show time adjustment screen
 void monitor_show_time_adjustment(const char* label, int minutes) {
+  monitor_animation_stop();
+  dropScene();
   display.clearDisplay();
   display.setTextColor(SSD1306_WHITE);
 
@@ -758,8 +949,23 @@ void monitor_show_time_adjustment(const char* label, int minutes) {
   display.display();
 }
 
+static_assert(TEXT_FRAMEBUFFER_WIDTH == SCREEN_WIDTH && TEXT_FRAMEBUFFER_PAGES * 8 == SCREEN_HEIGHT,
+              "text engine draws into the panel framebuffer");
+
 // Show mensa menu with navigation
-void monitor_show_mensa_menu(int currentIndex, int totalItems) {
+void monitor_show_mensa_menu(int currentIndex) {
+  // Items and count from one load: a refresh may have shortened the menu
+  int totalItems = 0;
+  const MensaMenuItem* items = request_get_menu(&totalItems);
+  if (currentIndex >= totalItems) {
+    currentIndex = totalItems - 1;
+  }
+  if (currentIndex < 0) {
+    currentIndex = 0;
+  }
+
+  monitor_animation_stop();
+  dropScene();
   display.clearDisplay();
   display.setTextSize(1);
   display.setTextColor(SSD1306_WHITE);
@@ -778,9 +984,7 @@ void monitor_show_mensa_menu(int currentIndex, int totalItems) {
     return;
   }
 
-  // Get menu items
-  MensaMenuItem* items = request_get_menu_items();
-  MensaMenuItem& item = items[currentIndex];
+  const MensaMenuItem& item = items[currentIndex];
 
   // Top bar - Navigation info
   display.setCursor(0, 0);
@@ -792,47 +996,22 @@ void monitor_show_mensa_menu(int currentIndex, int totalItems) {
   // Draw line separator
   display.drawLine(0, 9, 127, 9, SSD1306_WHITE);
 
-  // Display weekday and date
-  display.setCursor(0, 13);
-  display.print(item.weekday);
-  display.print(" ");
-  display.print(item.date);
+  // Weekday, date, title and price come from the menu feed as UTF-8 and go
+  // through the text engine; the fixed ASCII labels stay on GFX
+  uint8_t* framebuffer = display.getBuffer();
+  int16_t x = text_draw(framebuffer, 0, 13, item.weekday);
+  text_draw(framebuffer, x + TEXT_ADVANCE, 13, item.date);
 
   // Draw line separator
   display.drawLine(0, 22, 127, 22, SSD1306_WHITE);
 
-  // Display dish title (wrapped if necessary)
-  display.setCursor(0, 26);
-
-  // Word wrap the title to fit screen (max ~21 chars per line)
-  String title = item.title;
-  int lineHeight = 8;
-  int maxCharsPerLine = 21;
-  int yPos = 26;
-
-  if (title.length() <= maxCharsPerLine) {
-    display.println(title);
-  } else {
-    // Simple word wrap
-    int lastSpace = 0;
-    int lineStart = 0;
-
-    for (int i = 0; i < title.length() && yPos < 48; i++) {
-      if (title[i] == ' ') {
-        lastSpace = i;
-      }
-
-      if (i - lineStart >= maxCharsPerLine || i == title.length() - 1) {
-        int endPos = (i == title.length() - 1) ? i + 1 : lastSpace;
-        if (endPos <= lineStart) endPos = i; // No space found, hard break
-
-        display.setCursor(0, yPos);
-        display.println(title.substring(lineStart, endPos));
-        yPos += lineHeight;
-        lineStart = endPos + 1;
-        i = endPos;
-      }
-    }
+  // Dish title, word-wrapped on up to three lines above the separator
+  const char* line = item.title;
+  for (int16_t y = 26; y < 48 && *line != '\0'; y += TEXT_LINE_HEIGHT) {
+    const char* next;
+    size_t length = text_wrap(line, SCREEN_WIDTH, &next);
+    text_draw(framebuffer, 0, y, line, length);
+    line = next;
   }
 
   // Draw line separator
@@ -841,7 +1020,7 @@ void monitor_show_mensa_menu(int currentIndex, int totalItems) {
   // Bottom section - Price
   display.setCursor(0, 52);
   display.print("Price: CHF ");
-  display.print(item.price_chf);
+  text_draw(framebuffer, display.getCursorX(), 52, item.price_chf);
 
   // Navigation help
   display.setTextSize(1);
@@ -0,0 +1,151 @@
+#include "persist.h"
+#include "log.h"
+
+#include <Preferences.h>
+
+namespace {
+const char* const NVS_NAMESPACE = "pomodoro";
+const char* const SNAPSHOT_KEY = "snapshot";
+
+// Bump when PomodoroSnapshot changes layout; older blobs are then ignored
+const uint16_t SNAPSHOT_VERSION = 1;
+
+struct StoredSnapshot {
+  uint16_t version;
+  uint16_t size;
+  PomodoroSnapshot pomodoro;
+};
+
+Preferences prefs;
+bool opened = false;
+
+// What flash holds (or, before the first update, the state at boot)
+PomodoroSnapshot saved = {};
+bool haveBaseline = false;
+unsigned long savedAtMs = 0;
+
+// A change waiting for the minimum gap between writes
+PomodoroSnapshot pending = {};
+bool changePending = false;
+
+PersistStats stats = {};
+
+bool isCountingDown(uint8_t state) {
+  return state == POMODORO_WORK || state == POMODORO_SHORT_BREAK ||
+         state == POMODORO_LONG_BREAK;
+}
+
+// Equal apart from a running countdown ticking down
+bool sameTransitionState(const PomodoroSnapshot& a, const PomodoroSnapshot& b) {
+  return a.state == b.state && a.pausedSourceState == b.pausedSourceState &&
+         a.completedCount == b.completedCount && a.workDuration == b.workDuration &&
+         a.shortBreakDuration == b.shortBreakDuration &&
+         a.longBreakDuration == b.longBreakDuration &&
+         (isCountingDown(a.state) || a.remainingMs == b.remainingMs);
+}
+
+// A running countdown that no longer matches the saved one plus elapsed
+// time was set to a new length
+bool countdownJumped(const PomodoroSnapshot& current, unsigned long now) {
+  if (!isCountingDown(current.state)) {
+    return false;
+  }
+  long expected = static_cast<long>(saved.remainingMs) - static_cast<long>(now - savedAtMs);
+  long drift = static_cast<long>(current.remainingMs) - expected;
+  return drift > static_cast<long>(PERSIST_MIN_WRITE_GAP_MS) ||
+         drift < -static_cast<long>(PERSIST_MIN_WRITE_GAP_MS);
+}
+
+void write(const PomodoroSnapshot& snapshot, unsigned long now) {
+  StoredSnapshot stored;
+  stored.version = SNAPSHOT_VERSION;
+  stored.size = sizeof(PomodoroSnapshot);
+  stored.pomodoro = snapshot;
+
+  // Retry no sooner than the usual gap if the write fails
+  savedAtMs = now;
+  if (prefs.putBytes(SNAPSHOT_KEY, &stored, sizeof(stored)) != sizeof(stored)) {
+    LOG_W(LOG_POMODORO, "Saving the timer state failed");
+    return;
+  }
+  saved = snapshot;
+  changePending = false;
+  stats.writes++;
+}
+
+unsigned long msLeft(unsigned long since, unsigned long interval, unsigned long now) {
+  unsigned long elapsed = now - since;
+  return elapsed >= interval ? 0 : interval - elapsed;
+}
+}  // namespace
+
+void persist_init() {
+  opened = prefs.begin(NVS_NAMESPACE, false);
+  if (!opened) {
+    LOG_W(LOG_POMODORO, "NVS unavailable, timer state will not survive a reset");
+  }
+}
+
+bool persist_load_pomodoro(PomodoroSnapshot* snapshot) {
+  if (!opened || prefs.getBytesLength(SNAPSHOT_KEY) != sizeof(StoredSnapshot)) {
+    return false;
+  }
+  StoredSnapshot stored;
+  if (prefs.getBytes(SNAPSHOT_KEY, &stored, sizeof(stored)) != sizeof(stored) ||
+      stored.version != SNAPSHOT_VERSION || stored.size != sizeof(PomodoroSnapshot)) {
+    return false;
+  }
+  *snapshot = stored.pomodoro;
+  return true;
+}
+
+void persist_update(unsigned long now) {
+  if (!opened) {
+    return;
+  }
+
+  PomodoroSnapshot current;
+  pomodoro_get_snapshot(&current);
+
+  // The state found at boot is already what flash holds (or the default)
+  if (!haveBaseline) {
+    saved = current;
+    savedAtMs = now;
+    haveBaseline = true;
+    return;
+  }
+
+  if (!sameTransitionState(current, saved) || countdownJumped(current, now)) {
+    if (changePending && !sameTransitionState(current, pending)) {
+      stats.coalesced++;
+    }
+    pending = current;
+    changePending = true;
+  } else if (changePending) {
+    // Changed and changed back before it was written
+    changePending = false;
+    stats.coalesced++;
+  }
+
+  if (changePending) {
+    if (now - savedAtMs >= PERSIST_MIN_WRITE_GAP_MS) {
+      write(current, now);
+    }
+  } else if (isCountingDown(current.state) && now - savedAtMs >= PERSIST_PROGRESS_INTERVAL_MS) {
+    write(current, now);
+  }
+}
+
+unsigned long persist_ms_until_write(unsigned long now) {
+  if (changePending) {
+    return msLeft(savedAtMs, PERSIST_MIN_WRITE_GAP_MS, now);
+  }
+  if (isCountingDown(saved.state)) {
+    return msLeft(savedAtMs, PERSIST_PROGRESS_INTERVAL_MS, now);
+  }
+  return PERSIST_PROGRESS_INTERVAL_MS;
+}
+
+const PersistStats& persist_get_stats() {
+  return stats;
+}
@@ -1,10 +1,22 @@
 #include "pomodoro.h"
+#include "format.h"
+#include "history.h"
+#include "log.h"
+
+#if defined(ESP32)
+#include <esp_timer.h>
+#endif
+
+static const int64_t MICROS_PER_SECOND = 1000000LL;
 
 // Global state variables
 static PomodoroState currentState = POMODORO_IDLE;
 static PomodoroState pausedSourceState = POMODORO_IDLE;
-static unsigned long timeRemaining = 0;
-static unsigned long lastUpdateTime = 0;
+// While running, the session ends at an absolute monotonic deadline and the
+// remaining time is derived from it, so slow or stalled loop() iterations
+// never lose time. While paused, the remaining time is frozen instead.
+static int64_t deadlineUs = 0;
+static int64_t pausedRemainingUs = 0;
 static int completedPomodoros = 0;
 static bool isRunning = false;
 static bool timerFinished = false;
@@ -12,52 +24,156 @@ static unsigned long workDuration = WORK_DURATION;
 static unsigned long shortBreakDuration = SHORT_BREAK_DURATION;
 static unsigned long longBreakDuration = LONG_BREAK_DURATION;
 
+// 64-bit monotonic microseconds (never wraps in practice)
+static int64_t monotonicMicros() {
+#if defined(ESP32)
+  return esp_timer_get_time();
+#else
+  // Extend the 32-bit micros() counter; pomodoro_update() samples it far
+  // more often than once per ~71 minutes, so no wrap is missed.
+  static uint32_t lastMicros = 0;
+  static int64_t wrapBase = 0;
+  uint32_t now = static_cast<uint32_t>(micros());
+  if (now < lastMicros) {
+    wrapBase += (1LL << 32);
+  }
+  lastMicros = now;
+  return wrapBase + now;
+#endif
+}
+
+// Arm the deadline for a session of the given length starting now
+static void startCountdown(unsigned long seconds) {
+  deadlineUs = monotonicMicros() + static_cast<int64_t>(seconds) * MICROS_PER_SECOND;
+  pausedRemainingUs = 0;
+}
+
+static int64_t remainingMicros() {
+  if (currentState == POMODORO_IDLE) {
+    return 0;
+  }
+  if (!isRunning) {
+    return pausedRemainingUs;
+  }
+  int64_t remaining = deadlineUs - monotonicMicros();
+  return remaining > 0 ? remaining : 0;
+}
+
+static HistoryKind historyKindFor(PomodoroState state) {
+  if (state == POMODORO_SHORT_BREAK) return HISTORY_SHORT_BREAK;
+  if (state == POMODORO_LONG_BREAK) return HISTORY_LONG_BREAK;
+  return HISTORY_WORK;
+}
+
+static unsigned long durationFor(PomodoroState state) {
+  if (state == POMODORO_SHORT_BREAK) return shortBreakDuration;
+  if (state == POMODORO_LONG_BREAK) return longBreakDuration;
+  return workDuration;
+}
+
+// Log the session being replaced or abandoned, if any
+static void endUnfinishedSession() {
+  if (currentState != POMODORO_IDLE) {
+    history_session_end(false, static_cast<uint32_t>(remainingMicros() / MICROS_PER_SECOND));
+  }
+}
+
 // Initialize the pomodoro timer
 void pomodoro_init() {
   currentState = POMODORO_IDLE;
   pausedSourceState = POMODORO_IDLE;
-  timeRemaining = 0;
-  lastUpdateTime = millis();
+  deadlineUs = 0;
+  pausedRemainingUs = 0;
   completedPomodoros = 0;
   isRunning = false;
   timerFinished = false;
 
-  Serial.println("Pomodoro timer initialized");
+  LOG_I(LOG_POMODORO, "Pomodoro timer initialized");
+}
+
+void pomodoro_get_snapshot(PomodoroSnapshot* snapshot) {
+  snapshot->state = static_cast<uint8_t>(currentState);
+  snapshot->pausedSourceState = static_cast<uint8_t>(pausedSourceState);
+  snapshot->completedCount = static_cast<uint16_t>(completedPomodoros);
+  snapshot->remainingMs = static_cast<uint32_t>((remainingMicros() + 999) / 1000);
+  snapshot->workDuration = workDuration;
+  snapshot->shortBreakDuration = shortBreakDuration;
+  snapshot->longBreakDuration = longBreakDuration;
+}
+
+bool pomodoro_restore(const PomodoroSnapshot& snapshot) {
+  if (snapshot.state > POMODORO_PAUSED || snapshot.pausedSourceState > POMODORO_PAUSED ||
+      snapshot.workDuration == 0 || snapshot.shortBreakDuration == 0 ||
+      snapshot.longBreakDuration == 0) {
+    return false;
+  }
+
+  workDuration = snapshot.workDuration;
+  shortBreakDuration = snapshot.shortBreakDuration;
+  longBreakDuration = snapshot.longBreakDuration;
+  completedPomodoros = snapshot.completedCount;
+  currentState = static_cast<PomodoroState>(snapshot.state);
+  pausedSourceState = static_cast<PomodoroState>(snapshot.pausedSourceState);
+  timerFinished = false;
+
+  int64_t remainingUs = static_cast<int64_t>(snapshot.remainingMs) * 1000LL;
+  if (currentState == POMODORO_IDLE) {
+    isRunning = false;
+    deadlineUs = 0;
+    pausedRemainingUs = 0;
+  } else if (currentState == POMODORO_PAUSED) {
+    isRunning = false;
+    deadlineUs = 0;
+    pausedRemainingUs = remainingUs;
+  } else {
+    isRunning = true;
+    deadlineUs = monotonicMicros() + remainingUs;
+    pausedRemainingUs = 0;
+  }
+
+  if (currentState != POMODORO_IDLE) {
+    // Pause and presence counts from before the reset are not saved
+    PomodoroState kindState = currentState == POMODORO_PAUSED ? pausedSourceState : currentState;
+    uint32_t planned = durationFor(kindState);
+    uint32_t remaining = snapshot.remainingMs / 1000;
+    history_session_begin(historyKindFor(kindState), planned, planned > remaining ? planned - remaining : 0);
+  }
+
+  LOG_I(LOG_POMODORO, "Restored %s with %lu s left, completed pomodoros: %d",
+        format_state_name(currentState), static_cast<unsigned long>(snapshot.remainingMs / 1000),
+        completedPomodoros);
+  return true;
 }
 
 // Start a work session
 void pomodoro_start_work() {
+  endUnfinishedSession();
   currentState = POMODORO_WORK;
-  timeRemaining = workDuration;
-  lastUpdateTime = millis();
+  startCountdown(workDuration);
+  history_session_begin(HISTORY_WORK, workDuration);
   isRunning = true;
   timerFinished = false;
 
-  Serial.print("Starting work session (");
-  Serial.print(workDuration / 60);
-  Serial.println(" minutes)");
-  Serial.print("Completed pomodoros: ");
-  Serial.println(completedPomodoros);
+  LOG_I(LOG_POMODORO, "Starting work session (%lu minutes), completed pomodoros: %d",
+        workDuration / 60, completedPomodoros);
 }
 
 // Start a break (short or long based on completed pomodoros)
 void pomodoro_start_break() {
+  endUnfinishedSession();
+
   // Determine if it's time for a long break
   if (completedPomodoros > 0 && completedPomodoros % POMODOROS_UNTIL_LONG_BREAK == 0) {
     currentState = POMODORO_LONG_BREAK;
-    timeRemaining = longBreakDuration;
-    Serial.print("Starting long break (");
-    Serial.print(longBreakDuration / 60);
-    Serial.println(" minutes)");
+    startCountdown(longBreakDuration);
+    LOG_I(LOG_POMODORO, "Starting long break (%lu minutes)", longBreakDuration / 60);
   } else {
     currentState = POMODORO_SHORT_BREAK;
-    timeRemaining = shortBreakDuration;
-    Serial.print("Starting short break (");
-    Serial.print(shortBreakDuration / 60);
-    Serial.println(" minutes)");
+    startCountdown(shortBreakDuration);
+    LOG_I(LOG_POMODORO, "Starting short break (%lu minutes)", shortBreakDuration / 60);
   }
 
-  lastUpdateTime = millis();
+  history_session_begin(historyKindFor(currentState), durationFor(currentState));
   isRunning = true;
   timerFinished = false;
 }
@@ -65,10 +181,12 @@ void pomodoro_start_break() {
 // Pause the current timer
 void pomodoro_pause() {
   if (isRunning && currentState != POMODORO_IDLE) {
+    pausedRemainingUs = remainingMicros();
     isRunning = false;
     pausedSourceState = currentState;
     currentState = POMODORO_PAUSED;
-    Serial.println("Timer paused");
+    history_session_pause();
+    LOG_I(LOG_POMODORO, "Timer paused");
   }
 }
 
@@ -76,64 +194,57 @@ void pomodoro_pause() {
 void pomodoro_resume() {
   if (currentState == POMODORO_PAUSED) {
     isRunning = true;
-    lastUpdateTime = millis();
+    deadlineUs = monotonicMicros() + pausedRemainingUs;
+    pausedRemainingUs = 0;
     if (pausedSourceState != POMODORO_IDLE) {
       currentState = pausedSourceState;
     } else {
       currentState = POMODORO_WORK;
     }
     pausedSourceState = POMODORO_IDLE;
-    Serial.println("Timer resumed");
+    LOG_I(LOG_POMODORO, "Timer resumed");
   }
 }
 
 // Reset the timer
 void pomodoro_reset() {
+  endUnfinishedSession();
   currentState = POMODORO_IDLE;
-  timeRemaining = 0;
+  deadlineUs = 0;
+  pausedRemainingUs = 0;
   isRunning = false;
   timerFinished = false;
   completedPomodoros = 0;
   pausedSourceState = POMODORO_IDLE;
 
-  Serial.println("Timer reset");
-  Serial.println("Pomodoros reset to 0");
+  LOG_I(LOG_POMODORO, "Timer reset, pomodoros reset to 0");
 }
 
 // Update the timer (call this in loop)
 void pomodoro_update() {
-  if (!isRunning || currentState == POMODORO_IDLE) {
+  // Sample the clock every call so the micros() wrap tracking stays current
+  int64_t now = monotonicMicros();
+
+  if (!isRunning || currentState == POMODORO_IDLE || now < deadlineUs) {
     return;
   }
 
-  unsigned long currentTime = millis();
-  unsigned long elapsed = currentTime - lastUpdateTime;
-
-  // Update every second
-  if (elapsed >= 1000) {
-    lastUpdateTime = currentTime;
-
-    if (timeRemaining > 0) {
-      timeRemaining--;
-    } else {
-      // Timer finished
-      timerFinished = true;
-      isRunning = false;
-
-      // Handle state transitions
-      if (currentState == POMODORO_WORK) {
-        completedPomodoros++;
-        Serial.println("Work session completed!");
-        Serial.print("Total completed pomodoros: ");
-        Serial.println(completedPomodoros);
-        currentState = POMODORO_IDLE;
-        pausedSourceState = POMODORO_IDLE;
-      } else if (currentState == POMODORO_SHORT_BREAK || currentState == POMODORO_LONG_BREAK) {
-        Serial.println("Break completed!");
-        currentState = POMODORO_IDLE;
-        pausedSourceState = POMODORO_IDLE;
-      }
-    }
+  // Timer finished
+  timerFinished = true;
+  isRunning = false;
+  deadlineUs = 0;
+  history_session_end(true, 0);
+
+  // Handle state transitions
+  if (currentState == POMODORO_WORK) {
+    completedPomodoros++;
+    LOG_I(LOG_POMODORO, "Work session completed! Total completed pomodoros: %d", completedPomodoros);
+    currentState = POMODORO_IDLE;
+    pausedSourceState = POMODORO_IDLE;
+  } else if (currentState == POMODORO_SHORT_BREAK || currentState == POMODORO_LONG_BREAK) {
+    LOG_I(LOG_POMODORO, "Break completed!");
+    currentState = POMODORO_IDLE;
+    pausedSourceState = POMODORO_IDLE;
   }
 }
 
@@ -142,9 +253,23 @@ PomodoroState pomodoro_get_state() {
   return currentState;
 }
 
-// Get time remaining in seconds
+// Get time remaining in seconds (rounded up, so 00:00 only shows at the end)
 unsigned long pomodoro_get_time_remaining() {
-  return timeRemaining;
+  int64_t remaining = remainingMicros();
+  return static_cast<unsigned long>((remaining + MICROS_PER_SECOND - 1) / MICROS_PER_SECOND);
+}
+
+// Get the absolute deadline of the running session (0 when not running)
+int64_t pomodoro_get_deadline_us() {
+  return isRunning ? deadlineUs : 0;
+}
+
+// Get the time left in the running session in ms (0 when not running)
+unsigned long pomodoro_get_ms_until_deadline() {
+  if (!isRunning) {
+    return 0;
+  }
+  return static_cast<unsigned long>((remainingMicros() + 999) / 1000);
 }
 
 // Get completed pomodoros count
@@ -161,24 +286,6 @@ bool pomodoro_is_finished() {
   return finished;
 }
 
-// Get state as string
-String pomodoro_get_state_string() {
-  switch (currentState) {
-    case POMODORO_IDLE:
-      return "Idle";
-    case POMODORO_WORK:
-      return "Work";
-    case POMODORO_SHORT_BREAK:
-      return "Short Break";
-    case POMODORO_LONG_BREAK:
-      return "Long Break";
-    case POMODORO_PAUSED:
-      return "Paused";
-    default:
-      return "Unknown";
-  }
-}
-
 void pomodoro_set_work_duration(unsigned long seconds) {
   if (seconds == 0) return;
   workDuration = seconds;
@@ -207,9 +314,12 @@ unsigned long pomodoro_get_long_break_duration() {
 }
 
 void pomodoro_set_time_remaining(unsigned long seconds) {
-  timeRemaining = seconds;
+  if (isRunning) {
+    startCountdown(seconds);
+  } else {
+    pausedRemainingUs = static_cast<int64_t>(seconds) * MICROS_PER_SECOND;
+  }
   timerFinished = false;
-  lastUpdateTime = millis();
 }
 
 bool pomodoro_is_running() {
@@ -219,18 +329,3 @@ bool pomodoro_is_running() {
 PomodoroState pomodoro_get_paused_source_state() {
   return pausedSourceState;
 }
-
-// Format time as MM:SS
-String pomodoro_format_time(unsigned long seconds) {
-  unsigned long minutes = seconds / 60;
-  unsigned long secs = seconds % 60;
-
-  String timeStr = "";
-  if (minutes < 10) timeStr += "0";
-  timeStr += String(minutes);
-  timeStr += ":";
-  if (secs < 10) timeStr += "0";
-  timeStr += String(secs);
-
-  return timeStr;
-}
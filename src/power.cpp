@@ -0,0 +1,200 @@
+#include "power.h"
+#include "log.h"
+
+#if defined(ESP32)
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#if defined(CONFIG_PM_ENABLE)
+#include <esp_pm.h>
+#endif
+#endif
+
+namespace {
+const int MAX_WAKE_PINS = 4;
+
+struct WakePin {
+  uint8_t pin;
+  int interruptMode;
+};
+
+WakePin wakePins[MAX_WAKE_PINS];
+int wakePinCount = 0;
+
+PowerStats stats = {};
+uint64_t statsSinceUs = 0;
+uint64_t lastReturnUs = 0;
+
+#if defined(ESP32)
+TaskHandle_t idleTaskHandle = nullptr;
+#else
+volatile bool wakeRequested = false;
+#endif
+
+uint64_t nowUs() {
+#if defined(ESP32)
+  return static_cast<uint64_t>(esp_timer_get_time());
+#else
+  return static_cast<uint64_t>(micros());
+#endif
+}
+
+// First wake pin that reads LOW, or -1
+int lowWakePin() {
+  for (int i = 0; i < wakePinCount; i++) {
+    if (digitalRead(wakePins[i].pin) == LOW) {
+      return wakePins[i].pin;
+    }
+  }
+  return -1;
+}
+
+#if defined(ESP32)
+gpio_int_type_t edgeInterruptType(int mode) {
+  switch (mode) {
+    case RISING:
+      return GPIO_INTR_POSEDGE;
+    case FALLING:
+      return GPIO_INTR_NEGEDGE;
+    case CHANGE:
+    default:
+      return GPIO_INTR_ANYEDGE;
+  }
+}
+
+// Light sleep until the timer or a wake pin going LOW. Arming a pin for
+// wakeup replaces its edge interrupt with a level one, so the interrupt is
+// masked for the duration (a held button would otherwise retrigger it
+// forever on wake) and the pin's edge mode is put back afterwards.
+// Returns the pin that woke the chip, or -1.
+int lightSleep(uint32_t sleepMs) {
+  for (int i = 0; i < wakePinCount; i++) {
+    gpio_num_t gpio = static_cast<gpio_num_t>(wakePins[i].pin);
+    gpio_intr_disable(gpio);
+    gpio_wakeup_enable(gpio, GPIO_INTR_LOW_LEVEL);
+  }
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup(static_cast<uint64_t>(sleepMs) * 1000ULL);
+
+  // The UART stops with the clocks; let pending output leave first
+  Serial.flush();
+  esp_light_sleep_start();
+  // The ESP32 does not latch which GPIO woke it; read the levels straight
+  // away, before a short tap is over
+  int wakePin = -1;
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO) {
+    wakePin = lowWakePin();
+  }
+
+  for (int i = 0; i < wakePinCount; i++) {
+    gpio_num_t gpio = static_cast<gpio_num_t>(wakePins[i].pin);
+    gpio_wakeup_disable(gpio);
+    gpio_set_intr_type(gpio, edgeInterruptType(wakePins[i].interruptMode));
+    gpio_intr_enable(gpio);
+  }
+  return wakePin;
+}
+#endif
+}  // namespace
+
+void power_init() {
+#if defined(ESP32)
+  idleTaskHandle = xTaskGetCurrentTaskHandle();
+#if defined(CONFIG_PM_ENABLE)
+  esp_pm_config_esp32_t config = {};
+  config.max_freq_mhz = POWER_MAX_CPU_MHZ;
+  config.min_freq_mhz = POWER_MIN_CPU_MHZ;
+  config.light_sleep_enable = false;  // light sleep is entered explicitly
+  if (esp_pm_configure(&config) == ESP_OK) {
+    LOG_I(LOG_HARDWARE, "Power: CPU clock scales %d-%d MHz", POWER_MIN_CPU_MHZ, POWER_MAX_CPU_MHZ);
+  } else {
+    LOG_W(LOG_HARDWARE, "Power: frequency scaling unavailable");
+  }
+#endif
+#endif
+  statsSinceUs = lastReturnUs = nowUs();
+}
+
+void power_add_wake_pin(uint8_t pin, int interruptMode) {
+  if (wakePinCount >= MAX_WAKE_PINS) {
+    return;
+  }
+  wakePins[wakePinCount].pin = pin;
+  wakePins[wakePinCount].interruptMode = interruptMode;
+  wakePinCount++;
+}
+
+int power_idle(uint32_t sleepMs, bool allowLightSleep) {
+  uint64_t start = nowUs();
+  stats.activeUs += start - lastReturnUs;
+  if (sleepMs > POWER_MAX_SLEEP_MS) {
+    sleepMs = POWER_MAX_SLEEP_MS;
+  }
+
+  // A wake pin held LOW would end light sleep at once
+  bool lightSleeping = allowLightSleep && sleepMs >= POWER_LIGHT_SLEEP_MIN_MS && lowWakePin() < 0;
+  int wakePin = -1;
+
+#if defined(ESP32)
+  if (lightSleeping) {
+    wakePin = lightSleep(sleepMs);
+  } else if (sleepMs > 0) {
+    // Returns early when an input ISR calls power_wake_from_isr()
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleepMs));
+  }
+#else
+  // Host: wait in 1 ms steps so an input interrupt ends the wait the way
+  // the task notification does on the ESP32. Light sleep is modelled the
+  // same way, with the wake pins checked on every step.
+  for (uint32_t waited = 0; waited < sleepMs && !wakeRequested; waited++) {
+    delay(1);
+    if (lightSleeping && (wakePin = lowWakePin()) >= 0) {
+      break;
+    }
+  }
+  wakeRequested = false;
+#endif
+
+  lastReturnUs = nowUs();
+  if (lightSleeping) {
+    stats.lightSleepUs += lastReturnUs - start;
+  } else {
+    stats.waitUs += lastReturnUs - start;
+  }
+  stats.wakeups++;
+  return wakePin;
+}
+
+void IRAM_ATTR power_wake_from_isr() {
+#if defined(ESP32)
+  if (idleTaskHandle != nullptr) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(idleTaskHandle, &woken);
+    if (woken == pdTRUE) {
+      portYIELD_FROM_ISR();
+    }
+  }
+#else
+  wakeRequested = true;
+#endif
+}
+
+const PowerStats& power_get_stats() {
+  return stats;
+}
+
+float power_wakeups_per_second() {
+  uint64_t elapsedUs = nowUs() - statsSinceUs;
+  return elapsedUs > 0 ? stats.wakeups * 1e6f / elapsedUs : 0.0f;
+}
+
+float power_estimated_ma() {
+  float total = static_cast<float>(stats.activeUs + stats.waitUs + stats.lightSleepUs);
+  if (total <= 0.0f) {
+    return POWER_ACTIVE_MA;
+  }
+  return (stats.activeUs * POWER_ACTIVE_MA + stats.waitUs * POWER_WAIT_MA +
+          stats.lightSleepUs * POWER_LIGHT_SLEEP_MA) / total;
+}
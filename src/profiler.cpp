@@ -0,0 +1,225 @@
+#include "profiler.h"
+
+#if PROFILER_ENABLED
+
+#include "log.h"
+#include "power.h"
+
+#if defined(ESP32)
+#include <esp_timer.h>
+#endif
+
+namespace {
+const uint32_t BUCKET_BOUNDS_US[PROFILER_BUCKETS - 1] = PROFILER_BUCKET_BOUNDS_US;
+
+const char* const SECTION_NAMES[PROF_SECTION_COUNT] = {
+  "pomodoro", "buttons", "timer_done", "ultrasound", "shaking", "wifi",
+  "animation", "display", "buzzer", "log", "boot", "persist"
+};
+
+ProfileStats sections[PROF_SECTION_COUNT];
+LoopProfile loopProfile;
+
+// Ticks per microsecond: CPU cycles on ESP32, 1 where ticks are micros().
+// With frequency scaling the cycle rate changes under us, so the
+// microsecond timer is used instead.
+uint32_t ticksPerUs = 1;
+
+uint32_t loopStartTicks = 0;
+uint32_t loopStartMs = 0;
+ProfileSection loopCulprit = PROF_POMODORO;
+uint32_t loopCulpritUs = 0;
+
+// Serial command line being typed
+const size_t COMMAND_MAX = 24;
+char command[COMMAND_MAX];
+size_t commandLength = 0;
+
+// Report in progress: index of the next line, or -1 when idle. Line 0 is
+// the loop summary, line 1 input latency, line 2 the bucket legend, then
+// one line per section, and finally the power summary.
+const int REPORT_LINES = 4 + PROF_SECTION_COUNT;
+int reportLine = -1;
+
+void addSample(ProfileStats* stats, uint32_t us) {
+  stats->count++;
+  stats->totalUs += us;
+  if (us > stats->maxUs) {
+    stats->maxUs = us;
+  }
+  int bucket = 0;
+  while (bucket < PROFILER_BUCKETS - 1 && us > BUCKET_BOUNDS_US[bucket]) {
+    bucket++;
+  }
+  stats->buckets[bucket]++;
+}
+
+uint32_t meanUs(const ProfileStats& stats) {
+  return stats.count > 0 ? static_cast<uint32_t>(stats.totalUs / stats.count) : 0;
+}
+
+// Appends the bucket counts of `stats` to `out`
+void formatBuckets(const ProfileStats& stats, char* out, size_t size) {
+  size_t used = 0;
+  for (int i = 0; i < PROFILER_BUCKETS && used < size; i++) {
+    int n = snprintf(out + used, size - used, " %lu", static_cast<unsigned long>(stats.buckets[i]));
+    if (n < 0) {
+      break;
+    }
+    used += n;
+  }
+}
+
+void emitReportLine(int line) {
+  char buckets[80];
+  if (line == 0) {
+    formatBuckets(loopProfile.loop, buckets, sizeof(buckets));
+    log_write(LOG_LEVEL_INFO, LOG_APP,
+              "prof loop n=%lu mean=%luus max=%luus worst@%lums by %s (%luus) |%s",
+              static_cast<unsigned long>(loopProfile.loop.count),
+              static_cast<unsigned long>(meanUs(loopProfile.loop)),
+              static_cast<unsigned long>(loopProfile.loop.maxUs),
+              static_cast<unsigned long>(loopProfile.worstLoopAtMs),
+              SECTION_NAMES[loopProfile.worstLoopCulprit],
+              static_cast<unsigned long>(loopProfile.worstCulpritUs), buckets);
+  } else if (line == 1) {
+    const ProfileStats& stats = loopProfile.inputLatency;
+    formatBuckets(stats, buckets, sizeof(buckets));
+    log_write(LOG_LEVEL_INFO, LOG_APP, "prof input latency n=%lu mean=%luus max=%luus |%s",
+              static_cast<unsigned long>(stats.count),
+              static_cast<unsigned long>(meanUs(stats)),
+              static_cast<unsigned long>(stats.maxUs), buckets);
+  } else if (line == 2) {
+    size_t used = 0;
+    for (int i = 0; i < PROFILER_BUCKETS - 1 && used < sizeof(buckets); i++) {
+      int n = snprintf(buckets + used, sizeof(buckets) - used, " <=%lu",
+                       static_cast<unsigned long>(BUCKET_BOUNDS_US[i]));
+      if (n < 0) {
+        break;
+      }
+      used += n;
+    }
+    log_write(LOG_LEVEL_INFO, LOG_APP, "prof buckets (us):%s >%lu", buckets,
+              static_cast<unsigned long>(BUCKET_BOUNDS_US[PROFILER_BUCKETS - 2]));
+  } else if (line == REPORT_LINES - 1) {
+    const PowerStats& power = power_get_stats();
+    log_write(LOG_LEVEL_INFO, LOG_APP,
+              "prof power wakeups/s=%.1f active=%lums wait=%lums sleep=%lums est=%.1fmA",
+              power_wakeups_per_second(), static_cast<unsigned long>(power.activeUs / 1000),
+              static_cast<unsigned long>(power.waitUs / 1000),
+              static_cast<unsigned long>(power.lightSleepUs / 1000), power_estimated_ma());
+  } else {
+    const ProfileStats& stats = sections[line - 3];
+    formatBuckets(stats, buckets, sizeof(buckets));
+    log_write(LOG_LEVEL_INFO, LOG_APP, "prof %-12s n=%lu mean=%luus max=%luus |%s",
+              SECTION_NAMES[line - 3], static_cast<unsigned long>(stats.count),
+              static_cast<unsigned long>(meanUs(stats)),
+              static_cast<unsigned long>(stats.maxUs), buckets);
+  }
+}
+
+void runCommand() {
+  command[commandLength] = '\0';
+  if (strcmp(command, "prof") == 0) {
+    reportLine = 0;
+  } else if (strcmp(command, "prof reset") == 0) {
+    profiler_reset();
+    log_write(LOG_LEVEL_INFO, LOG_APP, "prof: statistics cleared");
+  }
+}
+}  // namespace
+
+void profiler_init() {
+#if defined(ESP32) && !defined(CONFIG_PM_ENABLE)
+  ticksPerUs = ESP.getCpuFreqMHz();
+#endif
+  profiler_reset();
+}
+
+uint32_t profiler_now() {
+#if defined(ESP32) && !defined(CONFIG_PM_ENABLE)
+  // 32 bits of cycles wrap after ~18 s at 240 MHz, far longer than any
+  // section; unsigned subtraction handles the wrap
+  return ESP.getCycleCount();
+#elif defined(ESP32)
+  return static_cast<uint32_t>(esp_timer_get_time());
+#else
+  return static_cast<uint32_t>(micros());
+#endif
+}
+
+void profiler_loop_begin() {
+  loopCulpritUs = 0;
+  loopCulprit = PROF_POMODORO;
+  loopStartMs = millis();
+  loopStartTicks = profiler_now();
+}
+
+void profiler_loop_end() {
+  uint32_t us = (profiler_now() - loopStartTicks) / ticksPerUs;
+  if (us > loopProfile.loop.maxUs) {
+    loopProfile.worstLoopAtMs = loopStartMs;
+    loopProfile.worstLoopCulprit = loopCulprit;
+    loopProfile.worstCulpritUs = loopCulpritUs;
+  }
+  addSample(&loopProfile.loop, us);
+}
+
+void profiler_record(ProfileSection section, uint32_t startTicks) {
+  uint32_t us = (profiler_now() - startTicks) / ticksPerUs;
+  addSample(&sections[section], us);
+  if (us > loopCulpritUs) {
+    loopCulpritUs = us;
+    loopCulprit = section;
+  }
+}
+
+void profiler_record_latency(uint32_t us) {
+  addSample(&loopProfile.inputLatency, us);
+}
+
+void profiler_update() {
+  while (Serial.available() > 0) {
+    int c = Serial.read();
+    if (c == '\n' || c == '\r') {
+      if (commandLength > 0) {
+        runCommand();
+      }
+      commandLength = 0;
+    } else if (commandLength < COMMAND_MAX - 1) {
+      command[commandLength++] = static_cast<char>(c);
+    }
+  }
+
+  // One line per call, and only when the log buffer can take it whole
+  if (reportLine >= 0 && log_buffer_free() >= LOG_LINE_MAX) {
+    emitReportLine(reportLine);
+    reportLine++;
+    if (reportLine >= REPORT_LINES) {
+      reportLine = -1;
+    }
+  }
+}
+
+void profiler_reset() {
+  memset(sections, 0, sizeof(sections));
+  memset(&loopProfile, 0, sizeof(loopProfile));
+}
+
+bool profiler_is_reporting() {
+  return reportLine >= 0;
+}
+
+const ProfileStats& profiler_get_section(ProfileSection section) {
+  return sections[section];
+}
+
+const LoopProfile& profiler_get_loop() {
+  return loopProfile;
+}
+
+const char* profiler_section_name(ProfileSection section) {
+  return SECTION_NAMES[section];
+}
+
+#endif  // PROFILER_ENABLED
@@ -3,55 +3,238 @@
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include "request.h"
+#include "log.h"
+
+#include <atomic>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
 
 namespace {
   const char* mensaApiUrl = "https://mensa-hsg.vercel.app/menu.json";
-  bool wifiInitialized = false;
-  MensaMenuItem menuItems[MAX_MENU_ITEMS];
-  int menuItemCount = 0;
+  WifiConnectionState wifiState = WIFI_CONN_IDLE;
+  unsigned long wifiStateSince = 0;
+  int wifiAttempts = 0;
+  const char* wifiSsid = nullptr;
+  const char* wifiPassword = nullptr;
+
+  // All menu text lives in one fixed arena; items point into it. Two arenas
+  // alternate: a fetch fills the spare one and only swaps it in once the
+  // whole response parsed, so readers never see a half-built menu and the
+  // heap is never touched for menu storage.
+  struct MenuArena {
+    char text[MENU_ARENA_SIZE];
+    size_t used;
+    MensaMenuItem items[MAX_MENU_ITEMS];
+    int count;
+  };
+
+  // Written by the fetch (its own task on ESP32) and read by the loop: the
+  // release store publishes the finished arena, readers load with acquire
+  MenuArena arenas[2];
+  std::atomic<MenuArena*> publishedMenu(&arenas[0]);
+
+  const char* const EMPTY_TEXT = "";
+
+  // Background fetch: the loop task starts it and collects the result
+  enum FetchStatus : uint8_t { FETCH_IDLE, FETCH_RUNNING, FETCH_OK, FETCH_FAILED };
+  std::atomic<uint8_t> fetchStatus(FETCH_IDLE);
+
+#if defined(ESP32)
+  const uint32_t FETCH_TASK_STACK = 8192;   // TLS handshake and JSON parsing
+  const UBaseType_t FETCH_TASK_PRIORITY = 1;
+
+  void fetchTask(void* arg) {
+    (void)arg;
+    bool ok = request_fetch_mensa_menu();
+    fetchStatus.store(ok ? FETCH_OK : FETCH_FAILED, std::memory_order_release);
+    vTaskDelete(nullptr);
+  }
+#endif
+
+  void arenaReset(MenuArena* arena) {
+    arena->used = 0;
+    arena->count = 0;
+  }
+
+  // Copy text into the arena; returns nullptr when it does not fit
+  const char* arenaStore(MenuArena* arena, const char* text) {
+    if (text == nullptr || text[0] == '\0') {
+      return EMPTY_TEXT;
+    }
+    size_t length = strlen(text) + 1;
+    if (arena->used + length > sizeof(arena->text)) {
+      return nullptr;
+    }
+    char* stored = arena->text + arena->used;
+    memcpy(stored, text, length);
+    arena->used += length;
+    return stored;
+  }
+
+  // Copy a field into the arena: strings as they are, anything else (the
+  // feed sends price_chf as a number at times) as its JSON text
+  const char* arenaStoreValue(MenuArena* arena, JsonVariantConst value) {
+    if (value.isNull() || value.is<const char*>()) {
+      return arenaStore(arena, value.as<const char*>());
+    }
+    size_t length = measureJson(value) + 1;
+    if (arena->used + length > sizeof(arena->text)) {
+      return nullptr;
+    }
+    char* stored = arena->text + arena->used;
+    serializeJson(value, stored, length);
+    arena->used += length;
+    return stored;
+  }
+
+  // weekday and source repeat across items; store each distinct value once
+  const char* arenaIntern(MenuArena* arena, JsonVariantConst value, const char* MensaMenuItem::*field) {
+    const char* text = value.as<const char*>();
+    if (text != nullptr) {
+      for (int i = 0; i < arena->count; i++) {
+        if (strcmp(arena->items[i].*field, text) == 0) {
+          return arena->items[i].*field;
+        }
+      }
+    }
+    return arenaStoreValue(arena, value);
+  }
+
+  // Skip JSON whitespace and return the next character without consuming it
+  int peekAfterWhitespace(Stream& stream) {
+    int c = stream.peek();
+    while (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+      stream.read();
+      c = stream.peek();
+    }
+    return c;
+  }
+}
+
+static void startConnectAttempt(unsigned long now) {
+  wifiAttempts++;
+  LOG_I(LOG_REQUEST, "WiFi: connecting to %s (attempt %d)", wifiSsid, wifiAttempts);
+
+  WiFi.disconnect();
+  WiFi.begin(wifiSsid, wifiPassword);
+  wifiState = WIFI_CONN_CONNECTING;
+  wifiStateSince = now;
+}
+
+// Exponential backoff: min, 2x min, 4x min, ... capped at the maximum
+static unsigned long backoffDelayMs() {
+  unsigned long delayMs = WIFI_BACKOFF_MIN_MS;
+  for (int i = 1; i < wifiAttempts && delayMs < WIFI_BACKOFF_MAX_MS; i++) {
+    delayMs *= 2;
+  }
+  return delayMs < WIFI_BACKOFF_MAX_MS ? delayMs : WIFI_BACKOFF_MAX_MS;
 }
 
-bool request_init(const char* ssid, const char* password) {
-  Serial.println("\n=== Connecting to WiFi ===");
-  Serial.print("SSID: ");
-  Serial.println(ssid);
+void request_begin(const char* ssid, const char* password) {
+  LOG_I(LOG_REQUEST, "=== Connecting to WiFi (SSID: %s) ===", ssid);
+
+  wifiSsid = ssid;
+  wifiPassword = password;
+  wifiAttempts = 0;
 
   WiFi.mode(WIFI_STA);
-  WiFi.begin(ssid, password);
-
-  // Wait for connection (30 second timeout)
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 60) {
-    delay(500);
-    Serial.print(".");
-    attempts++;
-  }
-
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("\n✓ WiFi Connected!");
-    Serial.print("IP Address: ");
-    Serial.println(WiFi.localIP());
-    Serial.print("Signal Strength (RSSI): ");
-    Serial.print(WiFi.RSSI());
-    Serial.println(" dBm");
-    wifiInitialized = true;
-    return true;
-  } else {
-    Serial.println("\n✗ WiFi Connection Failed!");
-    wifiInitialized = false;
-    return false;
+  // Reconnects are driven by request_update() so they follow the backoff
+  WiFi.setAutoReconnect(false);
+  startConnectAttempt(millis());
+}
+
+WifiConnectionState request_update() {
+  unsigned long now = millis();
+  bool linkUp = (WiFi.status() == WL_CONNECTED);
+
+  switch (wifiState) {
+    case WIFI_CONN_CONNECTING:
+      if (linkUp) {
+        LOG_I(LOG_REQUEST, "✓ WiFi Connected! IP Address: %s, RSSI: %d dBm",
+              WiFi.localIP().toString().c_str(), static_cast<int>(WiFi.RSSI()));
+        wifiAttempts = 0;
+        wifiState = WIFI_CONN_CONNECTED;
+        wifiStateSince = now;
+      } else if (now - wifiStateSince >= WIFI_ATTEMPT_TIMEOUT_MS) {
+        if (wifiAttempts >= WIFI_MAX_ATTEMPTS) {
+          LOG_W(LOG_REQUEST, "✗ WiFi Connection Failed! Radio off, retrying in %lu min",
+                WIFI_RETRY_INTERVAL_MS / 60000);
+          WiFi.disconnect(true);
+          wifiState = WIFI_CONN_FAILED;
+        } else {
+          LOG_W(LOG_REQUEST, "✗ WiFi attempt timed out, retrying in %lu s", backoffDelayMs() / 1000);
+          WiFi.disconnect();
+          wifiState = WIFI_CONN_BACKOFF;
+        }
+        wifiStateSince = now;
+      }
+      break;
+
+    case WIFI_CONN_BACKOFF:
+      if (now - wifiStateSince >= backoffDelayMs()) {
+        startConnectAttempt(now);
+      }
+      break;
+
+    case WIFI_CONN_CONNECTED:
+      if (!linkUp) {
+        // Link lost: reconnect right away, backing off only if that fails
+        LOG_W(LOG_REQUEST, "✗ WiFi connection lost, reconnecting");
+        wifiAttempts = 0;
+        startConnectAttempt(now);
+      }
+      break;
+
+    case WIFI_CONN_FAILED:
+      // The access point may be back (or just rebooted): a new series
+      if (now - wifiStateSince >= WIFI_RETRY_INTERVAL_MS) {
+        LOG_I(LOG_REQUEST, "WiFi: retrying after %lu min off", WIFI_RETRY_INTERVAL_MS / 60000);
+        wifiAttempts = 0;
+        WiFi.mode(WIFI_STA);
+        startConnectAttempt(now);
+      }
+      break;
+
+    case WIFI_CONN_IDLE:
+    default:
+      break;
+  }
+
+  return wifiState;
+}
+
+void request_reconnect() {
+  if (wifiSsid == nullptr || wifiState == WIFI_CONN_CONNECTED) {
+    return;
+  }
+  wifiAttempts = 0;
+  WiFi.mode(WIFI_STA);
+  startConnectAttempt(millis());
+}
+
+unsigned long request_ms_until_wifi_retry(unsigned long now) {
+  if (wifiState != WIFI_CONN_FAILED) {
+    return WIFI_RETRY_INTERVAL_MS;
   }
+  unsigned long off = now - wifiStateSince;
+  return off >= WIFI_RETRY_INTERVAL_MS ? 0 : WIFI_RETRY_INTERVAL_MS - off;
+}
+
+WifiConnectionState request_get_wifi_state() {
+  return wifiState;
 }
 
 bool request_fetch_mensa_menu() {
-  if (!wifiInitialized || WiFi.status() != WL_CONNECTED) {
-    Serial.println("✗ WiFi not connected! Call request_init() first.");
+  if (!request_is_wifi_connected()) {
+    LOG_W(LOG_REQUEST, "✗ WiFi not connected! Call request_begin() first.");
     return false;
   }
 
-  Serial.println("\n=== Fetching Mensa Menu ===");
-  Serial.print("URL: ");
-  Serial.println(mensaApiUrl);
+  LOG_I(LOG_REQUEST, "=== Fetching Mensa Menu ===");
+  LOG_D(LOG_REQUEST, "URL: %s", mensaApiUrl);
 
   HTTPClient http;
   http.begin(mensaApiUrl);
@@ -62,103 +245,141 @@ bool request_fetch_mensa_menu() {
   // Set connection timeout separately
   http.setConnectTimeout(10000);
 
+  // HTTP/1.0 keeps the body free of chunk markers so it can be parsed
+  // directly from the stream
+  http.useHTTP10(true);
+
   // Add user agent to avoid potential blocking
   http.addHeader("User-Agent", "ESP32-Mensa-Client/1.0");
   http.addHeader("Accept", "application/json");
 
-  Serial.println("Sending HTTP GET request...");
-  Serial.println("(This may take a few seconds...)");
+  LOG_D(LOG_REQUEST, "Sending HTTP GET request (this may take a few seconds)...");
 
   int httpResponseCode = http.GET();
 
   if (httpResponseCode > 0) {
-    Serial.print("✓ HTTP Response Code: ");
-    Serial.println(httpResponseCode);
+    LOG_I(LOG_REQUEST, "✓ HTTP Response Code: %d", httpResponseCode);
 
     if (httpResponseCode == 200) {
-      String payload = http.getString();
-      Serial.println("\n=== Mensa Menu ===");
-      Serial.println(payload);
-      Serial.println("==================\n");
-
-      // Parse JSON and store menu items
-      JsonDocument doc;
-      DeserializationError error = deserializeJson(doc, payload);
-
-      if (!error) {
-        Serial.println("=== Parsed Menu ===");
-
-        // The API returns a flat array of menu items
-        if (doc.is<JsonArray>()) {
-          JsonArray items = doc.as<JsonArray>();
-          int count = items.size();
-          Serial.print("Found ");
-          Serial.print(count);
-          Serial.println(" menu items\n");
-
-          // Store menu items (up to MAX_MENU_ITEMS)
-          menuItemCount = 0;
-          int index = 0;
-          for (JsonVariant item : items) {
-            if (index >= MAX_MENU_ITEMS) {
-              Serial.println("⚠ Menu limit reached, storing first 20 items only");
-              break;
-            }
-
-            // Store in global array
-            menuItems[index].date = item["date"].as<String>();
-            menuItems[index].weekday = item["weekday"].as<String>();
-            menuItems[index].title = item["title"].as<String>();
-            menuItems[index].price_chf = item["price_chf"].as<String>();
-            menuItems[index].source = item["source"].as<String>();
-
-            // Print to serial
-            Serial.print("[");
-            Serial.print(index + 1);
-            Serial.println("]");
-            Serial.print("Day: ");
-            Serial.println(menuItems[index].weekday);
-            Serial.print("Date: ");
-            Serial.println(menuItems[index].date);
-            Serial.print("Title: ");
-            Serial.println(menuItems[index].title);
-            Serial.print("Price: CHF ");
-            Serial.println(menuItems[index].price_chf);
-            Serial.println("---");
-
-            index++;
-            menuItemCount++;
+      // Parse the body straight from the socket, one array element at a
+      // time, keeping only the fields the menu screen shows. Peak memory is
+      // one filtered item, however large the menu is.
+      JsonDocument filter;
+      filter["date"] = true;
+      filter["weekday"] = true;
+      filter["title"] = true;
+      filter["price_chf"] = true;
+      filter["source"] = true;
+
+      Stream& stream = http.getStream();
+      JsonDocument item;
+      MenuArena* arena = (publishedMenu.load(std::memory_order_acquire) == &arenas[0]) ? &arenas[1] : &arenas[0];
+      arenaReset(arena);
+      bool complete = false;
+
+      // The API returns a flat array of menu items
+      if (!stream.find('[')) {
+        LOG_W(LOG_REQUEST, "✗ Expected JSON array but got different format");
+      } else {
+        LOG_I(LOG_REQUEST, "=== Parsed Menu ===");
+
+        bool more = (peekAfterWhitespace(stream) != ']');
+        complete = true;
+        while (more) {
+          if (arena->count >= MAX_MENU_ITEMS) {
+            LOG_W(LOG_REQUEST, "⚠ Menu limit reached, storing first 20 items only");
+            break;
           }
 
-          Serial.print("✓ Stored ");
-          Serial.print(menuItemCount);
-          Serial.println(" menu items in memory");
-        } else {
-          Serial.println("✗ Expected JSON array but got different format");
+          DeserializationError error =
+              deserializeJson(item, stream, DeserializationOption::Filter(filter));
+          if (error) {
+            LOG_W(LOG_REQUEST, "✗ JSON Parsing Failed: %s", error.c_str());
+            complete = false;
+            break;
+          }
+
+          // Store in the spare arena
+          MensaMenuItem stored;
+          stored.date = arenaStoreValue(arena, item["date"]);
+          stored.weekday = arenaIntern(arena, item["weekday"], &MensaMenuItem::weekday);
+          stored.title = arenaStoreValue(arena, item["title"]);
+          stored.price_chf = arenaStoreValue(arena, item["price_chf"]);
+          stored.source = arenaIntern(arena, item["source"], &MensaMenuItem::source);
+          if (!stored.date || !stored.weekday || !stored.title || !stored.price_chf || !stored.source) {
+            LOG_W(LOG_REQUEST, "⚠ Menu arena full, keeping the items stored so far");
+            break;
+          }
+          int index = arena->count;
+          arena->items[index] = stored;
+          arena->count++;
+
+          // Print to serial
+          LOG_D(LOG_REQUEST, "[%d] %s %s: %s (CHF %s)", index + 1, stored.weekday,
+                stored.date, stored.title, stored.price_chf);
+
+          // Next element, or the closing bracket
+          more = stream.findUntil(",", "]");
         }
+      }
 
-        Serial.println("==================");
+      if (complete) {
+        publishedMenu.store(arena, std::memory_order_release);
+        LOG_I(LOG_REQUEST, "✓ Stored %d menu items in memory (%lu/%d bytes)", arena->count,
+              static_cast<unsigned long>(arena->used), MENU_ARENA_SIZE);
       } else {
-        Serial.print("✗ JSON Parsing Failed: ");
-        Serial.println(error.c_str());
+        LOG_W(LOG_REQUEST, "✗ Keeping the previous menu");
       }
 
       http.end();
       return true;
     } else {
-      Serial.println("✗ Unexpected HTTP response code");
+      LOG_W(LOG_REQUEST, "✗ Unexpected HTTP response code");
     }
   } else {
-    Serial.print("✗ HTTP Request Failed: ");
-    Serial.println(http.errorToString(httpResponseCode));
+    LOG_W(LOG_REQUEST, "✗ HTTP Request Failed: %s", http.errorToString(httpResponseCode).c_str());
   }
 
   http.end();
   return false;
 }
 
+bool request_start_menu_fetch() {
+  if (fetchStatus.load(std::memory_order_acquire) == FETCH_RUNNING) {
+    return false;
+  }
+  fetchStatus.store(FETCH_RUNNING, std::memory_order_relaxed);
+
+#if defined(ESP32)
+  if (xTaskCreate(fetchTask, "menu_fetch", FETCH_TASK_STACK, nullptr,
+                  FETCH_TASK_PRIORITY, nullptr) == pdPASS) {
+    return true;
+  }
+  LOG_W(LOG_REQUEST, "✗ Could not start the fetch task, fetching inline");
+#endif
+  bool ok = request_fetch_mensa_menu();
+  fetchStatus.store(ok ? FETCH_OK : FETCH_FAILED, std::memory_order_release);
+  return true;
+}
+
+bool request_menu_fetch_running() {
+  return fetchStatus.load(std::memory_order_acquire) == FETCH_RUNNING;
+}
+
+bool request_menu_fetch_finished(bool* ok) {
+  uint8_t status = fetchStatus.load(std::memory_order_acquire);
+  if (status != FETCH_OK && status != FETCH_FAILED) {
+    return false;
+  }
+  fetchStatus.store(FETCH_IDLE, std::memory_order_relaxed);
+  if (ok != nullptr) {
+    *ok = (status == FETCH_OK);
+  }
+  return true;
+}
+
 bool request_is_wifi_connected() {
-  return wifiInitialized && (WiFi.status() == WL_CONNECTED);
+  return wifiState == WIFI_CONN_CONNECTED && (WiFi.status() == WL_CONNECTED);
 }
 
 int request_get_wifi_rssi() {
@@ -168,10 +389,16 @@ int request_get_wifi_rssi() {
   return 0;
 }
 
-MensaMenuItem* request_get_menu_items() {
-  return menuItems;
+const MensaMenuItem* request_get_menu(int* count) {
+  const MenuArena* menu = publishedMenu.load(std::memory_order_acquire);
+  *count = menu->count;
+  return menu->items;
+}
+
+const MensaMenuItem* request_get_menu_items() {
+  return publishedMenu.load(std::memory_order_acquire)->items;
 }
 
 int request_get_menu_count() {
-  return menuItemCount;
+  return publishedMenu.load(std::memory_order_acquire)->count;
 }
@@ -0,0 +1,210 @@
+#include "text.h"
+
+namespace {
+const uint32_t REPLACEMENT = 0xFFFD;
+
+// A glyph as drawn at row offset `shift` within a page: the column bytes
+// for the page it starts in and for the one below
+struct CachedGlyph {
+  uint16_t glyph;
+  uint8_t shift;
+  uint32_t lastUse;   // 0 = empty slot
+  uint8_t top[TEXT_FONT_COLUMNS];
+  uint8_t bottom[TEXT_FONT_COLUMNS];
+};
+
+CachedGlyph cache[TEXT_CACHE_SLOTS];
+uint32_t useClock = 0;
+TextCacheStats cacheStats = {};
+
+const char* endOf(const char* text, size_t length) {
+  return length == TEXT_TO_END ? text + strlen(text) : text + length;
+}
+
+// Index into TEXT_FONT, folding the punctuation menus like to use
+uint16_t glyphIndex(uint32_t cp) {
+  if (cp >= 0x20 && cp <= 0x7E) {
+    return static_cast<uint16_t>(cp - 0x20);
+  }
+  if (cp >= 0xA0 && cp <= 0xFF) {
+    return static_cast<uint16_t>(TEXT_FONT_LATIN1_INDEX + (cp - 0xA0));
+  }
+  switch (cp) {
+    case 0x20AC:
+      return TEXT_FONT_EURO_INDEX;
+    case 0x2010: case 0x2011: case 0x2012: case 0x2013: case 0x2014: case 0x2015:
+      return '-' - 0x20;
+    case 0x2018: case 0x2019: case 0x201A:
+      return '\'' - 0x20;
+    case 0x201C: case 0x201D: case 0x201E:
+      return '"' - 0x20;
+    default:
+      return TEXT_FONT_MISSING_INDEX;
+  }
+}
+
+const CachedGlyph& lookup(uint16_t glyph, uint8_t shift) {
+  CachedGlyph* victim = &cache[0];
+  for (int i = 0; i < TEXT_CACHE_SLOTS; i++) {
+    CachedGlyph& slot = cache[i];
+    if (slot.lastUse != 0 && slot.glyph == glyph && slot.shift == shift) {
+      slot.lastUse = ++useClock;
+      cacheStats.hits++;
+      return slot;
+    }
+    if (slot.lastUse < victim->lastUse) {
+      victim = &slot;
+    }
+  }
+
+  cacheStats.misses++;
+  const uint8_t* columns = TEXT_FONT + glyph * TEXT_FONT_COLUMNS;
+  victim->glyph = glyph;
+  victim->shift = shift;
+  victim->lastUse = ++useClock;
+  for (int c = 0; c < TEXT_FONT_COLUMNS; c++) {
+    victim->top[c] = static_cast<uint8_t>(columns[c] << shift);
+    victim->bottom[c] = shift == 0 ? 0 : static_cast<uint8_t>(columns[c] >> (8 - shift));
+  }
+  return *victim;
+}
+
+// OR one page's worth of a glyph into the framebuffer
+void blit(uint8_t* framebuffer, int16_t x, int16_t page, const uint8_t* columns) {
+  if (page < 0 || page >= TEXT_FRAMEBUFFER_PAGES) {
+    return;
+  }
+  uint8_t* row = framebuffer + page * TEXT_FRAMEBUFFER_WIDTH;
+  for (int c = 0; c < TEXT_FONT_COLUMNS; c++) {
+    int16_t column = x + c;
+    if (column >= 0 && column < TEXT_FRAMEBUFFER_WIDTH) {
+      row[column] |= columns[c];
+    }
+  }
+}
+}  // namespace
+
+uint32_t text_decode(const char** cursor, const char* end) {
+  const uint8_t* s = reinterpret_cast<const uint8_t*>(*cursor);
+  const uint8_t* stop = reinterpret_cast<const uint8_t*>(end);
+  uint8_t lead = s[0];
+  *cursor += 1;
+  if (lead < 0x80) {
+    return lead;
+  }
+
+  int extra;
+  uint32_t cp;
+  uint32_t minimum;
+  if ((lead & 0xE0) == 0xC0) {
+    extra = 1;
+    cp = lead & 0x1F;
+    minimum = 0x80;
+  } else if ((lead & 0xF0) == 0xE0) {
+    extra = 2;
+    cp = lead & 0x0F;
+    minimum = 0x800;
+  } else if ((lead & 0xF8) == 0xF0) {
+    extra = 3;
+    cp = lead & 0x07;
+    minimum = 0x10000;
+  } else {
+    return REPLACEMENT;  // stray continuation or invalid lead byte
+  }
+  if (stop - s <= extra) {
+    return REPLACEMENT;
+  }
+  for (int i = 1; i <= extra; i++) {
+    if ((s[i] & 0xC0) != 0x80) {
+      return REPLACEMENT;
+    }
+    cp = (cp << 6) | (s[i] & 0x3F);
+  }
+  if (cp < minimum || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+    return REPLACEMENT;  // overlong, out of range or a surrogate
+  }
+  *cursor += extra;
+  return cp;
+}
+
+int16_t text_width(const char* text, size_t length) {
+  const char* end = endOf(text, length);
+  int16_t width = 0;
+  while (text < end) {
+    text_decode(&text, end);
+    width += TEXT_ADVANCE;
+  }
+  return width;
+}
+
+size_t text_wrap(const char* text, int16_t maxWidth, const char** next) {
+  const char* end = text + strlen(text);
+  const char* cursor = text;
+  const char* lineEnd = nullptr;   // end of the last word that fit
+  const char* afterBreak = nullptr;
+  int16_t width = 0;
+
+  while (cursor < end) {
+    const char* glyphStart = cursor;
+    uint32_t cp = text_decode(&cursor, end);
+    if (cp == ' ') {
+      lineEnd = glyphStart;
+      afterBreak = cursor;
+    }
+    // The last glyph of a line may use its spacing column as the margin
+    if (width + TEXT_ADVANCE - 1 > maxWidth) {
+      if (cp == ' ' || lineEnd == nullptr) {
+        // Break here: at this space, or inside a word too long for a line
+        lineEnd = glyphStart;
+        afterBreak = cp == ' ' ? cursor : glyphStart;
+      }
+      if (afterBreak == text) {
+        afterBreak = cursor;  // not even one glyph fits; take it anyway
+        lineEnd = cursor;
+      }
+      while (afterBreak < end && *afterBreak == ' ') {
+        afterBreak++;
+      }
+      *next = afterBreak;
+      return lineEnd - text;
+    }
+    width += TEXT_ADVANCE;
+  }
+
+  *next = end;
+  return end - text;
+}
+
+int16_t text_draw(uint8_t* framebuffer, int16_t x, int16_t y, const char* text, size_t length) {
+  const char* end = endOf(text, length);
+  // Floor division: the page the top row falls in, and the offset in it
+  int16_t page = y >= 0 ? y / 8 : (y - 7) / 8;
+  uint8_t shift = static_cast<uint8_t>(y - page * 8);
+
+  while (text < end) {
+    uint32_t cp = text_decode(&text, end);
+    if (x >= TEXT_FRAMEBUFFER_WIDTH) {
+      x += TEXT_ADVANCE;
+      continue;
+    }
+    if (cp != ' ' && x > -TEXT_ADVANCE) {
+      const CachedGlyph& glyph = lookup(glyphIndex(cp), shift);
+      blit(framebuffer, x, page, glyph.top);
+      if (shift != 0) {
+        blit(framebuffer, x, page + 1, glyph.bottom);
+      }
+    }
+    x += TEXT_ADVANCE;
+  }
+  return x;
+}
+
+TextCacheStats text_get_cache_stats() {
+  return cacheStats;
+}
+
+void text_reset_cache() {
+  memset(cache, 0, sizeof(cache));
+  useClock = 0;
+  cacheStats = TextCacheStats();
+}
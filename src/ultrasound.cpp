@@ -1,54 +1,160 @@
 #include "ultrasound.h"
+#include "log.h"
+
+// Echo timeout, same budget the old pulseIn() call had
+static const unsigned long ECHO_TIMEOUT_US = 30000;
+// Hard limit on a ping, whatever the echo line does
+static const unsigned long ECHO_GIVE_UP_US = 2 * ECHO_TIMEOUT_US;
 
 // Global variables
 static float initialDistance = 0.0;
 static float measurements[3] = {0.0, 0.0, 0.0};
 static float lastSingleMeasurement = 0.0;
 
+// Ranging is asynchronous: a ping only fires the trigger, the echo edges
+// are timestamped by an interrupt, and ultrasound_update() turns the
+// published pulse width (or a timeout) into a distance.
+enum class PingPurpose {
+  NONE,
+  INITIAL,
+  SINGLE
+};
+
+static PingPurpose pingInFlight = PingPurpose::NONE;
+static unsigned long pingStartUs = 0;
+static bool singleReady = false;
+
+// Written only by the echo ISR. echoSeq is bumped after echoWidthUs is
+// stored, so a reader that sees a new sequence number sees its width.
+static volatile unsigned long echoRiseUs = 0;
+static volatile unsigned long echoWidthUs = 0;
+static volatile unsigned long echoEndUs = 0;
+static volatile uint32_t echoSeq = 0;
+static uint32_t echoSeqSeen = 0;
+
+static void IRAM_ATTR onEchoEdge() {
+  unsigned long now = micros();
+  if (digitalRead(ECHO_PIN) == HIGH) {
+    echoRiseUs = now;
+  } else {
+    echoWidthUs = now - echoRiseUs;
+    echoEndUs = now;
+    echoSeq = echoSeq + 1;
+  }
+}
+
 // Initialize ultrasound sensor pins
 void ultrasound_init() {
   pinMode(TRIG_PIN, OUTPUT);
   pinMode(ECHO_PIN, INPUT);
   digitalWrite(TRIG_PIN, LOW);
+  attachInterrupt(digitalPinToInterrupt(ECHO_PIN), onEchoEdge, CHANGE);
 }
 
-// Internal helper function to measure distance once
-static float measureOnce() {
+static float widthToDistance(unsigned long durationUs) {
+  return durationUs * 0.034 / 2.0;
+}
+
+// Send the 10us trigger burst; the sensor answers on ECHO_PIN by itself
+static void startPing(PingPurpose purpose) {
+  echoSeqSeen = echoSeq;
+  pingInFlight = purpose;
+
   // Clear trigger pin
   digitalWrite(TRIG_PIN, LOW);
   delayMicroseconds(2);
 
-  // Send 10us pulse
+  pingStartUs = micros();
   digitalWrite(TRIG_PIN, HIGH);
   delayMicroseconds(10);
   digitalWrite(TRIG_PIN, LOW);
+}
 
-  // Read echo pin with timeout
-  long duration = pulseIn(ECHO_PIN, HIGH, 30000); // 30ms timeout
-
-  // Calculate distance in cm
-  if (duration == 0) {
-    return -1.0; // No echo received
+// Returns true once the ping in flight has an echo or has timed out, and
+// stores the distance (-1.0 for no echo) in *distance
+static bool pingFinished(float* distance) {
+  unsigned long now = micros();
+  if (echoSeq != echoSeqSeen) {
+    unsigned long width = echoWidthUs;
+    unsigned long endUs = echoEndUs;
+    echoSeqSeen = echoSeq;
+    // An echo that ends past the timeout is the sensor's "nothing there";
+    // one that rose before the trigger is a stuck line letting go
+    bool risenAfterTrigger = static_cast<long>(endUs - width - pingStartUs) >= 0;
+    *distance = (risenAfterTrigger && endUs - pingStartUs <= ECHO_TIMEOUT_US) ? widthToDistance(width) : -1.0;
+    return true;
+  }
+  unsigned long elapsed = now - pingStartUs;
+  if (elapsed > ECHO_TIMEOUT_US && digitalRead(ECHO_PIN) == LOW) {
+    *distance = -1.0;  // No echo received
+    return true;
   }
+  // A line stuck or floating high (sensor unplugged) never falls; give up
+  // regardless of the pin so the next ping can go out
+  if (elapsed > ECHO_GIVE_UP_US) {
+    *distance = -1.0;
+    return true;
+  }
+  return false;
+}
 
-  float distance = duration * 0.034 / 2.0;
+// Blocking measurement for the multi-sample helper below
+static float measureOnce() {
+  float distance = -1.0;
+  startPing(PingPurpose::SINGLE);
+  while (!pingFinished(&distance)) {
+    delay(1);
+  }
+  pingInFlight = PingPurpose::NONE;
   return distance;
 }
 
+// Finish the ping in flight, if any (call every loop)
+void ultrasound_update() {
+  if (pingInFlight == PingPurpose::NONE) {
+    return;
+  }
+
+  float distance;
+  if (!pingFinished(&distance)) {
+    return;
+  }
+
+  if (pingInFlight == PingPurpose::INITIAL) {
+    initialDistance = distance;
+    LOG_I(LOG_ULTRASOUND, "Initial distance measured: %.2f cm", initialDistance);
+  } else {
+    singleReady = true;
+  }
+  lastSingleMeasurement = distance;
+  pingInFlight = PingPurpose::NONE;
+}
+
 // Measure and save the initial distance
 void ultrasound_measure_initial_distance() {
-  initialDistance = measureOnce();
-  lastSingleMeasurement = initialDistance;
-
-  Serial.print("Initial distance measured: ");
-  Serial.print(initialDistance);
-  Serial.println(" cm");
+  startPing(PingPurpose::INITIAL);
 }
 
 // Take a single measurement and store it (for continuous monitoring)
 void ultrasound_take_single_measurement() {
-  float measurement = measureOnce();
-  lastSingleMeasurement = measurement;
+  // Let a ping that is still in flight finish rather than restart it
+  if (pingInFlight != PingPurpose::NONE) {
+    return;
+  }
+  singleReady = false;
+  startPing(PingPurpose::SINGLE);
+}
+
+// True while a ping is waiting for its echo (or its timeout)
+bool ultrasound_is_busy() {
+  return pingInFlight != PingPurpose::NONE;
+}
+
+// True once per completed single measurement
+bool ultrasound_measurement_ready() {
+  bool ready = singleReady;
+  singleReady = false;
+  return ready;
 }
 
 // Store a measurement at a specific index (0, 1, or 2)
@@ -60,17 +166,13 @@ void ultrasound_store_measurement(int index, float measurement) {
 
 // Take 3 measurements (1 per second) and save them in an array
 void ultrasound_measure_distance() {
-  Serial.println("Taking 3 measurements (1 per second)...");
+  LOG_I(LOG_ULTRASOUND, "Taking 3 measurements (1 per second)...");
 
   for (int i = 0; i < 3; i++) {
     measurements[i] = measureOnce();
     lastSingleMeasurement = measurements[i];
 
-    Serial.print("Measurement ");
-    Serial.print(i + 1);
-    Serial.print(": ");
-    Serial.print(measurements[i]);
-    Serial.println(" cm");
+    LOG_D(LOG_ULTRASOUND, "Measurement %d: %.2f cm", i + 1, measurements[i]);
 
     // Wait 1 second between measurements (except after last one)
     if (i < 2) {
@@ -86,10 +188,10 @@ bool ultrasound_compare_distances() {
   // Check if all three measurements are exactly equal
   if (measurements[0] == measurements[1] &&
       measurements[1] == measurements[2]) {
-    Serial.println("All measurements are exactly the same");
+    LOG_D(LOG_ULTRASOUND, "All measurements are exactly the same");
     return false; // All the same
   } else {
-    Serial.println("Measurements are different");
+    LOG_D(LOG_ULTRASOUND, "Measurements are different");
     return true; // Not the same
   }
 }
@@ -98,40 +200,31 @@ bool ultrasound_compare_distances() {
 bool ultrasound_compare_range() {
   // Check if any measurement is -1.0 (no echo received)
   if (measurements[0] == -1.0 || measurements[1] == -1.0 || measurements[2] == -1.0) {
-    Serial.println("One or more measurements failed (no echo) - out of range");
+    LOG_I(LOG_ULTRASOUND, "One or more measurements failed (no echo) - out of range");
     return false;
   }
 
   // Check if initial distance is -1.0
   if (initialDistance == -1.0) {
-    Serial.println("Initial distance invalid - out of range");
+    LOG_I(LOG_ULTRASOUND, "Initial distance invalid - out of range");
     return false;
   }
 
   // Calculate average of the 3 measurements
   float average = (measurements[0] + measurements[1] + measurements[2]) / 3.0;
 
-  Serial.print("Average of 3 measurements: ");
-  Serial.print(average);
-  Serial.println(" cm");
-
-  Serial.print("Initial distance: ");
-  Serial.print(initialDistance);
-  Serial.println(" cm");
-
   // Calculate difference from initial distance
   float difference = abs(average - initialDistance);
 
-  Serial.print("Difference from initial: ");
-  Serial.print(difference);
-  Serial.println(" cm");
+  LOG_D(LOG_ULTRASOUND, "Average of 3 measurements: %.2f cm, initial %.2f cm, difference %.2f cm",
+        average, initialDistance, difference);
 
   // Check if within 25cm range
   if (difference <= 25.0) {
-    Serial.println("Within 25cm range of initial measurement");
+    LOG_D(LOG_ULTRASOUND, "Within 25cm range of initial measurement");
     return true;
   } else {
-    Serial.println("Outside 25cm range of initial measurement");
+    LOG_D(LOG_ULTRASOUND, "Outside 25cm range of initial measurement");
     return false;
   }
 }
@@ -0,0 +1,135 @@
+// The hardware-scrolled banner on panels running off the nominal 105 Hz.
+// The firmware times a revolution from the nominal rate and cannot read
+// the real one back, so at the oscillator's tolerance the controller stops
+// short of (or past) where the piece started. Every piece must still be
+// put up centred from an unrotated RAM, and handing the ticker back to
+// software mid-revolution must leave the panel showing the piece where it
+// was held, with no RAM write ever sent while the controller scrolls.
+//
+// Run with: pio test -e native -f test_banner_hw_scroll
+
+#include <Arduino.h>
+#include <unity.h>
+#include "monitor.h"
+#include "native_hal.h"
+
+#include <string.h>
+
+namespace {
+const int64_t MS = 1000;
+const int BANNER_FIRST_PAGE = 6;
+const int BANNER_PAGES = 2;
+const int REVOLUTIONS = 6;
+
+uint8_t held[BANNER_PAGES * SCREEN_WIDTH];
+
+// Pages 6-7 as on the panel, without the separator line in row 48
+void bannerPages(uint8_t* out) {
+  memcpy(out, native_ssd1306_gddram() + BANNER_FIRST_PAGE * SCREEN_WIDTH, BANNER_PAGES * SCREEN_WIDTH);
+  for (int c = 0; c < SCREEN_WIDTH; c++) {
+    out[c] &= 0xFE;
+  }
+}
+
+// Blank columns left of the piece minus those right of it; a piece drawn
+// centred from unrotated RAM is within a glyph's side bearings of 0
+int centringError(const uint8_t* pages) {
+  int first = SCREEN_WIDTH;
+  int last = -1;
+  for (int c = 0; c < SCREEN_WIDTH; c++) {
+    if (pages[c] != 0 || pages[SCREEN_WIDTH + c] != 0) {
+      if (first == SCREEN_WIDTH) first = c;
+      last = c;
+    }
+  }
+  TEST_ASSERT_GREATER_OR_EQUAL(0, last);
+  return first - (SCREEN_WIDTH - 1 - last);
+}
+
+// One pass of the idle loop, then sleep until the banner next moves
+void idleStep() {
+  monitor_show_idle_screen(MODE_WORK, 0);
+  unsigned long wait = monitor_banner_ms_until_change(millis());
+  native_hal_advance_us((wait == 0 ? 1 : wait > 20 ? 20 : wait) * MS);
+}
+
+void runAtFrameRate(uint32_t hz) {
+  native_ssd1306_set_frame_hz(hz);
+  monitor_set_banner_hardware_scroll(false);
+  monitor_set_banner_hardware_scroll(true);
+  const uint32_t violations = native_ssd1306_scroll_violations();
+
+  // Hardware mode takes over at the next held message
+  int revolutions = 0;
+  bool wasScrolling = false;
+  while (revolutions < REVOLUTIONS) {
+    idleStep();
+    bool scrolling = native_ssd1306_scrolling();
+    if (wasScrolling && !scrolling) {
+      // The next piece, put up after a stop at the nominal revolution time
+      bannerPages(held);
+      TEST_ASSERT_INT_WITHIN(3, 0, centringError(held));
+      revolutions++;
+    }
+    if (scrolling) {
+      TEST_ASSERT_TRUE(monitor_banner_hardware_scroll_active());
+    }
+    wasScrolling = scrolling;
+  }
+
+  // Hand back half way round the next revolution
+  while (!native_ssd1306_scrolling()) {
+    idleStep();
+  }
+  bannerPages(held);
+  native_hal_advance_us(1800 * MS);
+  uint8_t rotated[BANNER_PAGES * SCREEN_WIDTH];
+  bannerPages(rotated);
+  TEST_ASSERT_FALSE(memcmp(held, rotated, sizeof(held)) == 0);
+
+  monitor_set_banner_hardware_scroll(false);
+  TEST_ASSERT_FALSE(native_ssd1306_scrolling());
+  TEST_ASSERT_FALSE(monitor_banner_hardware_scroll_active());
+  uint8_t after[BANNER_PAGES * SCREEN_WIDTH];
+  bannerPages(after);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(held, after, sizeof(held));
+
+  // The software ticker carries on from there
+  for (int i = 0; i < 200; i++) {
+    idleStep();
+  }
+  TEST_ASSERT_EQUAL(violations, native_ssd1306_scroll_violations());
+  native_ssd1306_set_frame_hz(0);
+}
+}  // namespace
+
+void setUp() {
+  native_hal_set_quiet(true);
+  static bool initialized = false;
+  if (!initialized) {
+    TEST_ASSERT_TRUE(monitor_init());
+    initialized = true;
+  }
+}
+
+void tearDown() {}
+
+void test_slow_panel() {
+  runAtFrameRate(95);
+}
+
+void test_nominal_panel() {
+  runAtFrameRate(105);
+}
+
+void test_fast_panel() {
+  runAtFrameRate(115);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_slow_panel);
+  RUN_TEST(test_nominal_panel);
+  RUN_TEST(test_fast_panel);
+  return UNITY_END();
+}
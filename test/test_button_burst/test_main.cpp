@@ -0,0 +1,211 @@
+// Bouncy button bursts that pile up while loop() is blocked (the 3 s
+// completion delay, a menu fetch), with a buttons_resync() landing in the
+// middle of them or bringing in a chord the masked interrupts missed. However the edges, the resync and the time-based checks
+// come out of the debouncer, every press and release must reach
+// buttons_next_event() in order and nothing may be dropped.
+//
+// Run with: pio test -e native -f test_button_burst
+
+#include <Arduino.h>
+#include <unity.h>
+#include "buttons.h"
+#include "native_hal.h"
+
+namespace {
+const uint64_t MS = 1000;
+const uint8_t PINS[BUTTON_COUNT] = {BUTTON1_PIN, BUTTON2_PIN};
+// Edges per bouncy press or release, all inside the debounce lockout
+const int BOUNCE_EDGES = 3;
+const uint64_t BOUNCE_STEP_US = 300;
+const uint64_t TAP_SPACING_US = 70 * MS;
+const uint64_t CHORD_HOLD_US = BUTTON_LONG_PRESS_MS * MS + 500 * MS;
+const int MAX_TAPS = (BUTTON_EDGE_QUEUE_SIZE - 4 * BOUNCE_EDGES) / (2 * BOUNCE_EDGES);
+
+// `level` at atUs, with the contact bouncing back once before it holds
+void bouncyEdge(uint8_t pin, uint8_t level, uint64_t atUs) {
+  for (int i = 0; i < BOUNCE_EDGES; i++) {
+    native_hal_schedule_pin(pin, i % 2 == 0 ? level : !level, atUs + i * BOUNCE_STEP_US);
+  }
+}
+
+void bouncyPress(uint8_t pin, uint64_t atUs, uint64_t holdUs) {
+  bouncyEdge(pin, LOW, atUs);
+  bouncyEdge(pin, HIGH, atUs + holdUs);
+}
+
+struct Seen {
+  int presses;      // PRESS, DOUBLE_CLICK or CHORD
+  int releases;
+  int longPresses;
+  bool down;
+};
+
+uint32_t lastEventUs = 0;
+
+// Drain the queue as loop() does, checking each button's events alternate
+// and all of them go forward in time
+void drain(Seen* seen) {
+  ButtonEvent event;
+  while (buttons_next_event(&event)) {
+    TEST_ASSERT_LESS_THAN(BUTTON_COUNT, event.button);
+    Seen& s = seen[event.button];
+    TEST_ASSERT_TRUE_MESSAGE(static_cast<int32_t>(event.timeUs - lastEventUs) >= 0, "event out of order");
+    lastEventUs = event.timeUs;
+    switch (event.type) {
+      case BUTTON_EVENT_PRESS:
+      case BUTTON_EVENT_DOUBLE_CLICK:
+      case BUTTON_EVENT_CHORD:
+        TEST_ASSERT_FALSE_MESSAGE(s.down, "press while already down");
+        s.down = true;
+        s.presses++;
+        break;
+      case BUTTON_EVENT_RELEASE:
+        TEST_ASSERT_TRUE_MESSAGE(s.down, "release while up");
+        s.down = false;
+        s.releases++;
+        break;
+      case BUTTON_EVENT_LONG_PRESS:
+        TEST_ASSERT_TRUE_MESSAGE(s.down, "long press while up");
+        s.longPresses++;
+        break;
+    }
+  }
+}
+
+// Queue `taps` alternating bouncy taps held for holdUs (shorter than the
+// lockout they end when it runs out) from startUs; returns when they end
+uint64_t scheduleTaps(int taps, uint64_t holdUs, uint64_t startUs, int* tapsPerButton) {
+  for (int k = 0; k < taps; k++) {
+    bouncyPress(PINS[k % BUTTON_COUNT], startUs + k * TAP_SPACING_US, holdUs);
+    tapsPerButton[k % BUTTON_COUNT]++;
+  }
+  return startUs + taps * TAP_SPACING_US;
+}
+
+// Every tap and the chord came out whole, with nothing lost on the way
+void checkBurst(const ButtonStats& before, const Seen* seen, const int* tapsPerButton, int taps) {
+  const ButtonStats& after = buttons_get_stats();
+  TEST_ASSERT_EQUAL(0, after.overflows - before.overflows);
+  TEST_ASSERT_EQUAL(0, after.droppedEvents - before.droppedEvents);
+  for (int b = 0; b < BUTTON_COUNT; b++) {
+    TEST_ASSERT_EQUAL(tapsPerButton[b] + 1, seen[b].presses);
+    TEST_ASSERT_EQUAL(tapsPerButton[b] + 1, seen[b].releases);
+    TEST_ASSERT_EQUAL(1, seen[b].longPresses);
+  }
+  TEST_ASSERT_EQUAL(taps + BUTTON_COUNT, after.presses - before.presses);
+
+  // Let the last lockouts run out before the next burst
+  native_hal_advance_us(BUTTON_DOUBLE_CLICK_MS * MS);
+  Seen idle[BUTTON_COUNT] = {};
+  drain(idle);
+  for (int b = 0; b < BUTTON_COUNT; b++) {
+    TEST_ASSERT_EQUAL(0, idle[b].presses + idle[b].releases);
+  }
+}
+
+// `taps` taps, then both buttons held past a long press, all queued with
+// nobody draining; buttons_resync() after `resyncAfter` taps (past the
+// last one: just before the drain)
+void runBurst(int taps, uint64_t holdUs, int resyncAfter) {
+  Seen seen[BUTTON_COUNT] = {};
+  int tapsPerButton[BUTTON_COUNT] = {};
+  const ButtonStats before = buttons_get_stats();
+  const uint64_t startUs = native_hal_now_us() + MS;
+  const uint64_t chordUs = scheduleTaps(taps, holdUs, startUs, tapsPerButton);
+  for (int b = 0; b < BUTTON_COUNT; b++) {
+    bouncyPress(PINS[b], chordUs + b * 5 * MS, CHORD_HOLD_US);
+  }
+  // Long presses are timed when the queue is drained, so drain once while
+  // the chord is still held and again after it is let go
+  const uint64_t heldUs = chordUs + CHORD_HOLD_US - 100 * MS;
+  const uint64_t endUs = chordUs + CHORD_HOLD_US + 100 * MS;
+
+  // loop() blocked: time passes, the ISRs queue edges, only the resync runs
+  uint64_t resyncUs = resyncAfter > taps ? heldUs - MS : startUs + resyncAfter * TAP_SPACING_US + holdUs / 2;
+  native_hal_advance_us(resyncUs - native_hal_now_us());
+  buttons_resync();
+  native_hal_advance_us(heldUs - native_hal_now_us());
+  drain(seen);
+  native_hal_advance_us(endUs - native_hal_now_us());
+  drain(seen);
+
+  checkBurst(before, seen, tapsPerButton, taps);
+}
+
+// The same taps, but the chord starts while the interrupts are masked (as
+// in light sleep): only the buttons_resync() after waking sees it, and its
+// events land on a queue the taps have already filled
+void runUnseenChord(int taps, uint64_t holdUs) {
+  Seen seen[BUTTON_COUNT] = {};
+  int tapsPerButton[BUTTON_COUNT] = {};
+  const ButtonStats before = buttons_get_stats();
+  const uint64_t chordUs = scheduleTaps(taps, holdUs, native_hal_now_us() + MS, tapsPerButton);
+
+  native_hal_advance_us(chordUs - native_hal_now_us());
+  for (int b = 0; b < BUTTON_COUNT; b++) {
+    native_hal_mask_pin_interrupt(PINS[b], true);
+    native_hal_set_pin(PINS[b], LOW);
+  }
+  native_hal_advance_us(10 * MS);
+  for (int b = 0; b < BUTTON_COUNT; b++) {
+    native_hal_mask_pin_interrupt(PINS[b], false);
+  }
+  buttons_resync();
+  native_hal_advance_us(CHORD_HOLD_US - 100 * MS);
+  drain(seen);
+  for (int b = 0; b < BUTTON_COUNT; b++) {
+    bouncyEdge(PINS[b], HIGH, native_hal_now_us() + b * 5 * MS);
+  }
+  native_hal_advance_us(200 * MS);
+  drain(seen);
+
+  checkBurst(before, seen, tapsPerButton, taps);
+}
+}  // namespace
+
+void setUp() {
+  native_hal_set_quiet(true);
+  static bool initialized = false;
+  if (!initialized) {
+    for (int b = 0; b < BUTTON_COUNT; b++) {
+      native_hal_set_pin(PINS[b], HIGH);
+    }
+    buttons_init();
+    initialized = true;
+  }
+}
+
+void tearDown() {}
+
+void test_every_burst_comes_out_whole() {
+  TEST_ASSERT_GREATER_OR_EQUAL(8, MAX_TAPS);
+  const uint64_t holds[] = {15 * MS, 45 * MS};
+  int bursts = 0;
+  for (uint64_t holdUs : holds) {
+    for (int taps = 1; taps <= MAX_TAPS; taps++) {
+      for (int resyncAfter = 0; resyncAfter <= taps + 1; resyncAfter++) {
+        runBurst(taps, holdUs, resyncAfter);
+        bursts++;
+      }
+    }
+  }
+  char summary[80];
+  snprintf(summary, sizeof(summary), "%d bursts of up to %d bouncy taps and a chord", bursts, MAX_TAPS);
+  TEST_MESSAGE(summary);
+}
+
+void test_resync_after_a_burst_loses_nothing() {
+  const uint64_t holds[] = {15 * MS, 45 * MS};
+  for (uint64_t holdUs : holds) {
+    for (int taps = 1; taps <= MAX_TAPS; taps++) {
+      runUnseenChord(taps, holdUs);
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_every_burst_comes_out_whole);
+  RUN_TEST(test_resync_after_a_burst_loses_nothing);
+  return UNITY_END();
+}
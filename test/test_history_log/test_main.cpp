@@ -0,0 +1,185 @@
+// Session history on the host flash image: the ring wraps around once the
+// partition is full, a reboot finds the head again from the sector
+// sequence numbers, and the rolling 7-day focus totals drop days as they
+// leave the window.
+//
+// Run with: pio test -e native -f test_history_log
+
+#include <Arduino.h>
+#include <unity.h>
+#include "history.h"
+#include "native_hal.h"
+
+namespace {
+const uint32_t MINUTES_PER_DAY = 1440;
+const uint64_t MINUTE_US = 60ULL * 1000 * 1000;
+const uint32_t RECORDS_PER_SECTOR = HISTORY_SECTOR_SIZE / sizeof(HistoryRecord) - 1;
+const uint32_t SECTORS = HISTORY_HOST_FLASH_SIZE / HISTORY_SECTOR_SIZE;
+
+HistoryRecord makeRecord(uint32_t startMinute, HistoryKind kind, uint16_t actualSeconds) {
+  HistoryRecord record;
+  record.startMinute = startMinute;
+  record.kind = kind;
+  record.completed = 1;
+  record.pauses = startMinute % 32;
+  record.actualSeconds = actualSeconds;
+  record.plannedMinutes = 25;
+  record.presenceLosses = startMinute % 256;
+  return record;
+}
+
+// First minute of the device day after the current one
+uint32_t nextDayStart() {
+  return (history_now_minutes() / MINUTES_PER_DAY + 1) * MINUTES_PER_DAY;
+}
+
+void assertSameRecord(const HistoryRecord& expected, const HistoryRecord& actual) {
+  TEST_ASSERT_EQUAL(expected.startMinute, actual.startMinute);
+  TEST_ASSERT_EQUAL(expected.kind, actual.kind);
+  TEST_ASSERT_EQUAL(expected.pauses, actual.pauses);
+  TEST_ASSERT_EQUAL(expected.actualSeconds, actual.actualSeconds);
+  TEST_ASSERT_EQUAL(expected.presenceLosses, actual.presenceLosses);
+}
+
+// One record per minute from `first`, work and short breaks alternating,
+// so record i is easy to recompute
+HistoryRecord recordAt(uint32_t first, uint32_t i) {
+  return makeRecord(first + i, i % 2 == 0 ? HISTORY_WORK : HISTORY_SHORT_BREAK,
+                    static_cast<uint16_t>(1 + i % 1500));
+}
+}  // namespace
+
+void setUp() {
+  native_hal_set_quiet(true);
+  TEST_ASSERT_TRUE(history_init());
+  history_clear();
+}
+
+void tearDown() {}
+
+void test_ring_wraps_around_when_full() {
+  const uint32_t capacity = SECTORS * RECORDS_PER_SECTOR;
+  const uint32_t appended = capacity + 3 * RECORDS_PER_SECTOR + 17;
+  const uint32_t first = nextDayStart();
+
+  for (uint32_t i = 0; i < appended; i++) {
+    TEST_ASSERT_TRUE(history_append(recordAt(first, i)));
+  }
+
+  // Reusing a sector drops its records; the head sector is part full
+  HistoryTotals totals;
+  history_get_totals(&totals);
+  TEST_ASSERT_EQUAL((SECTORS - 1) * RECORDS_PER_SECTOR + 17, totals.records);
+
+  HistoryRecord record;
+  for (uint32_t index = 0; index < totals.records; index += 997) {
+    TEST_ASSERT_TRUE(history_read(index, &record));
+    assertSameRecord(recordAt(first, appended - 1 - index), record);
+  }
+  TEST_ASSERT_TRUE(history_read(totals.records - 1, &record));
+  assertSameRecord(recordAt(first, appended - totals.records), record);
+  TEST_ASSERT_FALSE(history_read(totals.records, &record));
+}
+
+void test_reboot_finds_the_head_again() {
+  const uint32_t capacity = SECTORS * RECORDS_PER_SECTOR;
+  const uint32_t appended = capacity + 5 * RECORDS_PER_SECTOR + 200;
+  // End mid-day, so the day the clock resumes in is the newest record's
+  const uint32_t first = nextDayStart() + 600 - appended % MINUTES_PER_DAY + MINUTES_PER_DAY;
+
+  for (uint32_t i = 0; i < appended; i++) {
+    TEST_ASSERT_TRUE(history_append(recordAt(first, i)));
+  }
+  HistoryTotals before;
+  history_get_totals(&before);
+
+  TEST_ASSERT_TRUE(history_init());
+  HistoryTotals after;
+  history_get_totals(&after);
+  TEST_ASSERT_EQUAL(before.records, after.records);
+  TEST_ASSERT_EQUAL(before.weekFocusSeconds, after.weekFocusSeconds);
+  TEST_ASSERT_EQUAL(before.weekSessions, after.weekSessions);
+  TEST_ASSERT_EQUAL(before.todayFocusSeconds, after.todayFocusSeconds);
+  TEST_ASSERT_EQUAL(before.todaySessions, after.todaySessions);
+  TEST_ASSERT_GREATER_THAN(0, after.weekSessions);
+
+  HistoryRecord record;
+  TEST_ASSERT_TRUE(history_read(0, &record));
+  assertSameRecord(recordAt(first, appended - 1), record);
+  TEST_ASSERT_TRUE(history_read(after.records - 1, &record));
+  assertSameRecord(recordAt(first, appended - after.records), record);
+
+  // The clock carries on from the end of the newest session
+  TEST_ASSERT_GREATER_OR_EQUAL(first + appended - 1, history_now_minutes());
+
+  // Appending continues in the same head sector, and every fill level of
+  // it is found again by the search
+  for (uint32_t extra = 0; extra < RECORDS_PER_SECTOR + 2; extra++) {
+    uint32_t i = appended + extra;
+    TEST_ASSERT_TRUE(history_append(recordAt(first, i)));
+    TEST_ASSERT_TRUE(history_init());
+    TEST_ASSERT_TRUE(history_read(0, &record));
+    assertSameRecord(recordAt(first, i), record);
+    history_get_totals(&after);
+    TEST_ASSERT_GREATER_OR_EQUAL((SECTORS - 1) * RECORDS_PER_SECTOR, after.records);
+    TEST_ASSERT_LESS_OR_EQUAL(SECTORS * RECORDS_PER_SECTOR, after.records);
+  }
+}
+
+// Day k holds one work session of (k + 1) minutes and a break that does not
+// count; the window keeps the newest HISTORY_WINDOW_DAYS days
+void test_rolling_totals_retire_old_days() {
+  const uint32_t firstDay = nextDayStart() / MINUTES_PER_DAY;
+  const uint32_t days = 10;
+  HistoryTotals totals;
+
+  for (uint32_t k = 0; k < days; k++) {
+    uint32_t dayStart = (firstDay + k) * MINUTES_PER_DAY;
+    TEST_ASSERT_TRUE(history_append(makeRecord(dayStart + 60, HISTORY_WORK, (k + 1) * 60)));
+    TEST_ASSERT_TRUE(history_append(makeRecord(dayStart + 90, HISTORY_SHORT_BREAK, 300)));
+
+    uint32_t oldest = k + 1 > HISTORY_WINDOW_DAYS ? k + 1 - HISTORY_WINDOW_DAYS : 0;
+    uint32_t expected = 0;
+    for (uint32_t j = oldest; j <= k; j++) {
+      expected += (j + 1) * 60;
+    }
+    history_get_totals(&totals);
+    TEST_ASSERT_EQUAL((k + 1) * 60, totals.todayFocusSeconds);
+    TEST_ASSERT_EQUAL(1, totals.todaySessions);
+    TEST_ASSERT_EQUAL(expected, totals.weekFocusSeconds);
+    TEST_ASSERT_EQUAL(k + 1 - oldest, totals.weekSessions);
+  }
+
+  // Let the device clock run on past the newest day: each day that passes
+  // retires one more, with nothing appended
+  uint32_t newestDay = firstDay + days - 1;
+  native_hal_advance_us(static_cast<uint64_t>((newestDay + 1) * MINUTES_PER_DAY - history_now_minutes()) * MINUTE_US);
+  for (uint32_t later = 1; later <= HISTORY_WINDOW_DAYS; later++) {
+    history_get_totals(&totals);
+    TEST_ASSERT_EQUAL(0, totals.todayFocusSeconds);
+    TEST_ASSERT_EQUAL(0, totals.todaySessions);
+    uint32_t expected = 0;
+    uint16_t sessions = 0;
+    for (uint32_t k = 0; k < days; k++) {
+      if (firstDay + k + HISTORY_WINDOW_DAYS > newestDay + later) {
+        expected += (k + 1) * 60;
+        sessions++;
+      }
+    }
+    TEST_ASSERT_EQUAL(expected, totals.weekFocusSeconds);
+    TEST_ASSERT_EQUAL(sessions, totals.weekSessions);
+    TEST_ASSERT_EQUAL(2 * days, totals.records);
+    native_hal_advance_us(MINUTES_PER_DAY * MINUTE_US);
+  }
+  history_get_totals(&totals);
+  TEST_ASSERT_EQUAL(0, totals.weekFocusSeconds);
+  TEST_ASSERT_EQUAL(0, totals.weekSessions);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_ring_wraps_around_when_full);
+  RUN_TEST(test_reboot_finds_the_head_again);
+  RUN_TEST(test_rolling_totals_retire_old_days);
+  return UNITY_END();
+}
@@ -0,0 +1,108 @@
+// The menu fetch against the mock server: every field ends up as text in
+// the arena whatever its JSON type, and a large menu streams through with
+// a small, bounded heap peak. The peak and the parse time are printed, so
+// this run doubles as the measurement for the library in lib_deps.
+//
+// Run with: pio test -e native -f test_menu_fetch
+
+#include <Arduino.h>
+#include <unity.h>
+#include "native_hal.h"
+#include "request.h"
+
+#include <chrono>
+#include <string>
+
+namespace {
+// Items like the feed sends them, with the unfiltered bulk that used to be
+// buffered along with the rest
+std::string largeMenu(int items) {
+  std::string body = "[";
+  for (int i = 0; i < items; i++) {
+    char item[512];
+    snprintf(item, sizeof(item),
+             "%s{\"date\": \"2026-10-%02d\", \"weekday\": \"Montag\", \"title\": \"Menu %d with a long "
+             "description of the dish and sides\", \"price_chf\": \"%d.50\", \"source\": \"hsg\", "
+             "\"allergens\": [\"gluten\", \"milk\", \"eggs\"], \"nutrition\": {\"kcal\": %d, "
+             "\"protein\": 30, \"notes\": \"",
+             i == 0 ? "" : ", ", 1 + i % 28, i, 8 + i % 5, 600 + i);
+    body += item;
+    body.append(300, 'x');
+    body += "\"}}";
+  }
+  body += "]";
+  return body;
+}
+
+void serve(const std::string& body) {
+  native_net_set_body(body.data(), body.size());
+  if (request_get_wifi_state() != WIFI_CONN_CONNECTED) {
+    request_begin("test", "test");
+    request_update();
+  }
+}
+}  // namespace
+
+void setUp() {
+  native_hal_set_quiet(true);
+}
+
+void tearDown() {}
+
+void test_non_string_fields_are_stored_as_text() {
+  serve("[{\"date\": \"2026-10-05\", \"weekday\": \"Montag\", \"title\": \"Rösti\", \"price_chf\": 8.5,"
+        " \"source\": \"hsg\"},"
+        " {\"date\": 20261005, \"weekday\": \"Montag\", \"title\": \"Salat\", \"price_chf\": 12,"
+        " \"source\": null},"
+        " {\"weekday\": true, \"title\": \"Pasta\", \"price_chf\": \"10.50\", \"source\": \"hsg\"}]");
+  TEST_ASSERT_TRUE(request_is_wifi_connected());
+  TEST_ASSERT_TRUE(request_fetch_mensa_menu());
+  TEST_ASSERT_EQUAL(3, request_get_menu_count());
+
+  const MensaMenuItem* items = request_get_menu_items();
+  TEST_ASSERT_EQUAL_STRING("8.5", items[0].price_chf);
+  TEST_ASSERT_EQUAL_STRING("20261005", items[1].date);
+  TEST_ASSERT_EQUAL_STRING("12", items[1].price_chf);
+  TEST_ASSERT_EQUAL_STRING("", items[1].source);
+  TEST_ASSERT_EQUAL_STRING("", items[2].date);
+  TEST_ASSERT_EQUAL_STRING("true", items[2].weekday);
+  TEST_ASSERT_EQUAL_STRING("10.50", items[2].price_chf);
+  // Interned values are shared between items
+  TEST_ASSERT_TRUE(items[0].weekday == items[1].weekday);
+  TEST_ASSERT_TRUE(items[0].source == items[2].source);
+}
+
+void test_large_menu_streams_with_a_small_heap_peak() {
+  const int ITEMS = 400;
+  std::string body = largeMenu(ITEMS);
+  serve(body);
+
+  native_hal_reset_heap_peak();
+  const uint64_t heapBefore = native_hal_heap().currentBytes;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  TEST_ASSERT_TRUE(request_fetch_mensa_menu());
+  double parseUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  const uint64_t peak = native_hal_heap().peakBytes - heapBefore;
+
+  TEST_ASSERT_EQUAL(MAX_MENU_ITEMS, request_get_menu_count());
+  const MensaMenuItem* items = request_get_menu_items();
+  TEST_ASSERT_EQUAL_STRING("Menu 19 with a long description of the dish and sides", items[19].title);
+  TEST_ASSERT_EQUAL_STRING("12.50", items[19].price_chf);
+  // Nothing allocated for the menu outlives the fetch
+  TEST_ASSERT_EQUAL(heapBefore, native_hal_heap().currentBytes);
+
+  char summary[160];
+  snprintf(summary, sizeof(summary), "%lu byte body, %d items kept: heap peak %llu bytes, parse %.0f us (host)",
+           static_cast<unsigned long>(body.size()), MAX_MENU_ITEMS, static_cast<unsigned long long>(peak),
+           parseUs);
+  TEST_MESSAGE(summary);
+  // The body alone is ~220 KB; only one filtered item may be in memory
+  TEST_ASSERT_LESS_THAN(16384, peak);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_non_string_fields_are_stored_as_text);
+  RUN_TEST(test_large_menu_streams_with_a_small_heap_peak);
+  return UNITY_END();
+}
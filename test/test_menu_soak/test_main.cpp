@@ -0,0 +1,177 @@
+// Thousands of menu refreshes through the background-fetch API, cycling
+// through large, small, empty, truncated and oversized responses. Menu
+// storage lives in the static arenas, so every refresh must hand the heap
+// back exactly as it found it and allocate the same amount each time: a
+// refresh that leaves nothing behind cannot fragment the heap, whatever
+// the largest free block reads on the device. After each refresh the menu
+// screen is drawn with an index from the longest menu and must show the
+// last item of the one now published.
+//
+// Run with: pio test -e native -f test_menu_soak
+
+#include <Arduino.h>
+#include <unity.h>
+#include "monitor.h"
+#include "native_hal.h"
+#include "request.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+const int REFRESHES = 5000;
+const size_t GDDRAM_BYTES = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+
+struct Response {
+  const char* name;
+  std::string body;
+  int expectedCount;   // -1: keeps the previous menu
+};
+
+std::string menuBody(int items, size_t titleLength, bool numericPrices) {
+  std::string body = "[";
+  for (int i = 0; i < items; i++) {
+    char item[256];
+    if (numericPrices) {
+      snprintf(item, sizeof(item),
+               "%s{\"date\": \"2026-10-%02d\", \"weekday\": \"%s\", \"price_chf\": %d.5, \"source\": \"hsg\", "
+               "\"nutrition\": {\"kcal\": %d}, \"title\": \"",
+               i == 0 ? "" : ", ", 1 + i % 28, i % 2 ? "Dienstag" : "Montag", 8 + i % 5, 600 + i);
+    } else {
+      snprintf(item, sizeof(item),
+               "%s{\"date\": \"2026-10-%02d\", \"weekday\": \"Mittwoch\", \"price_chf\": \"%d.50\", "
+               "\"source\": \"hsg\", \"title\": \"",
+               i == 0 ? "" : ", ", 1 + i % 28, 8 + i % 5);
+    }
+    body += item;
+    body += "Gericht ";
+    body += std::to_string(i);
+    body.append(titleLength, 'e');
+    body += "\"}";
+  }
+  body += "]";
+  return body;
+}
+
+std::vector<Response> responses;
+uint8_t screen[GDDRAM_BYTES];
+
+void serve(const std::string& body) {
+  native_net_set_body(body.data(), body.size());
+  if (request_get_wifi_state() != WIFI_CONN_CONNECTED) {
+    request_begin("test", "test");
+    request_update();
+  }
+}
+
+// The refresh as main.cpp runs it: start, then collect the result
+bool refresh() {
+  if (!request_start_menu_fetch()) {
+    return false;
+  }
+  bool ok = false;
+  while (!request_menu_fetch_finished(&ok)) {
+    native_hal_advance_us(1000);
+  }
+  return ok;
+}
+
+void snapshotScreen(int index) {
+  monitor_show_mensa_menu(index);
+  memcpy(screen, native_ssd1306_gddram(), GDDRAM_BYTES);
+}
+}  // namespace
+
+void setUp() {
+  native_hal_set_quiet(true);
+  static bool initialized = false;
+  if (!initialized) {
+    TEST_ASSERT_TRUE(monitor_init());
+    initialized = true;
+  }
+  if (responses.empty()) {
+    std::string large = menuBody(400, 40, true);
+    responses.push_back({"large", large, MAX_MENU_ITEMS});
+    responses.push_back({"small", menuBody(3, 10, false), 3});
+    // Cut off inside the eleventh item: a parse error keeps the old menu
+    responses.push_back({"truncated", large.substr(0, large.find("Gericht 10")), -1});
+    responses.push_back({"empty", "[]", 0});
+    // Titles too long for the arena end the menu early
+    responses.push_back({"oversized", menuBody(MAX_MENU_ITEMS, 400, false), -2});
+  }
+}
+
+void tearDown() {}
+
+void test_refreshes_leave_the_heap_as_they_found_it() {
+  std::vector<uint64_t> allocationsPerResponse(responses.size(), 0);
+  uint64_t worstPeakBytes = 0;
+  int previousCount = request_get_menu_count();
+
+  for (int i = 0; i < REFRESHES; i++) {
+    size_t which = static_cast<size_t>(i) % responses.size();
+    const Response& response = responses[which];
+    serve(response.body);
+
+    native_hal_reset_heap_peak();
+    const NativeHeapStats before = native_hal_heap();
+    TEST_ASSERT_TRUE(refresh());
+    const NativeHeapStats after = native_hal_heap();
+
+    TEST_ASSERT_EQUAL(before.currentBytes, after.currentBytes);
+    uint64_t allocations = after.allocations - before.allocations;
+    if (i < static_cast<int>(responses.size())) {
+      allocationsPerResponse[which] = allocations;
+    } else {
+      TEST_ASSERT_EQUAL(allocationsPerResponse[which], allocations);
+    }
+    if (after.peakBytes - before.currentBytes > worstPeakBytes) {
+      worstPeakBytes = after.peakBytes - before.currentBytes;
+    }
+
+    int count = 0;
+    const MensaMenuItem* items = request_get_menu(&count);
+    if (response.expectedCount == -1) {
+      TEST_ASSERT_EQUAL(previousCount, count);
+    } else if (response.expectedCount == -2) {
+      TEST_ASSERT_GREATER_THAN(0, count);
+      TEST_ASSERT_LESS_THAN(MAX_MENU_ITEMS, count);
+    } else {
+      TEST_ASSERT_EQUAL(response.expectedCount, count);
+    }
+    for (int n = 0; n < count; n++) {
+      TEST_ASSERT_NOT_NULL(items[n].title);
+      TEST_ASSERT_NOT_NULL(items[n].price_chf);
+      TEST_ASSERT_TRUE(strlen(items[n].title) < MENU_ARENA_SIZE);
+    }
+    previousCount = count;
+
+    // An index left over from a longer menu draws the last item
+    if (i % 50 < static_cast<int>(responses.size()) && count > 0) {
+      snapshotScreen(count - 1);
+      uint8_t expected[GDDRAM_BYTES];
+      memcpy(expected, screen, GDDRAM_BYTES);
+      snapshotScreen(MAX_MENU_ITEMS - 1);
+      TEST_ASSERT_TRUE(memcmp(expected, screen, GDDRAM_BYTES) == 0);
+    }
+  }
+
+  char summary[200];
+  snprintf(summary, sizeof(summary),
+           "%d refreshes: heap in use unchanged by every one, peak %llu bytes above it, "
+           "%llu/%llu/%llu/%llu/%llu allocations per large/small/truncated/empty/oversized",
+           REFRESHES, static_cast<unsigned long long>(worstPeakBytes),
+           static_cast<unsigned long long>(allocationsPerResponse[0]),
+           static_cast<unsigned long long>(allocationsPerResponse[1]),
+           static_cast<unsigned long long>(allocationsPerResponse[2]),
+           static_cast<unsigned long long>(allocationsPerResponse[3]),
+           static_cast<unsigned long long>(allocationsPerResponse[4]));
+  TEST_MESSAGE(summary);
+  TEST_ASSERT_LESS_THAN(16384, worstPeakBytes);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_refreshes_leave_the_heap_as_they_found_it);
+  return UNITY_END();
+}
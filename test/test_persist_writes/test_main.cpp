@@ -0,0 +1,153 @@
+// Flash wear of the pomodoro persistence, counted by the Preferences
+// stand-in: a day of back-to-back sessions stays inside the per-day write
+// budget persist.h promises, an idle day writes nothing, and a burst of
+// button presses after a saved transition lands in flash as one more write.
+//
+// Run with: pio test -e native -f test_persist_writes
+
+#include <Arduino.h>
+#include <unity.h>
+#include "native_hal.h"
+#include "persist.h"
+#include "pomodoro.h"
+
+namespace {
+const uint64_t MS = 1000;
+const uint64_t SECOND = 1000 * MS;
+const uint64_t DAY = 86400 * SECOND;
+
+uint32_t seed = 1;
+
+uint32_t nextRandom() {
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+// One loop() iteration's worth of virtual time, then the persist hook
+void step(uint64_t us) {
+  native_hal_advance_us(us);
+  pomodoro_update();
+  persist_update(millis());
+}
+
+uint64_t flashWrites() {
+  return native_hal_stats().nvsWrites;
+}
+
+bool sameSnapshot(const PomodoroSnapshot& a, const PomodoroSnapshot& b) {
+  return a.state == b.state && a.pausedSourceState == b.pausedSourceState &&
+         a.completedCount == b.completedCount && a.workDuration == b.workDuration &&
+         a.shortBreakDuration == b.shortBreakDuration && a.longBreakDuration == b.longBreakDuration;
+}
+}  // namespace
+
+void setUp() {
+  native_hal_set_quiet(true);
+  seed = 2024;
+  persist_init();
+  pomodoro_reset();
+  // Let whatever the previous test left behind reach flash, then count
+  // from a clean slate
+  step(PERSIST_MIN_WRITE_GAP_MS * MS);
+  step(PERSIST_MIN_WRITE_GAP_MS * MS);
+  native_hal_reset_stats();
+}
+
+void tearDown() {}
+
+void test_idle_day_writes_nothing() {
+  const uint64_t endUs = native_hal_now_us() + DAY;
+  while (native_hal_now_us() < endUs) {
+    step(10 * MS + nextRandom() % (990 * MS));
+  }
+  TEST_ASSERT_EQUAL(0, flashWrites());
+}
+
+// Sessions around the clock: every start and finish is a transition, and
+// the running countdown is re-saved once per PERSIST_PROGRESS_INTERVAL_MS
+void test_busy_day_stays_within_write_budget() {
+  const uint64_t endUs = native_hal_now_us() + DAY;
+  uint32_t transitions = 0;
+  bool work = true;
+
+  while (native_hal_now_us() < endUs) {
+    if (work) {
+      pomodoro_start_work();
+    } else {
+      pomodoro_start_break();
+    }
+    transitions++;
+    while (pomodoro_get_state() != POMODORO_IDLE && native_hal_now_us() < endUs) {
+      step(5 * MS + nextRandom() % (200 * MS));
+    }
+    if (pomodoro_is_finished()) {
+      transitions++;
+    }
+    work = !work;
+  }
+
+  const uint64_t progressBudget = 86400000ULL / PERSIST_PROGRESS_INTERVAL_MS;
+  char summary[160];
+  snprintf(summary, sizeof(summary), "%llu flash writes in a day, %lu transitions, budget %llu",
+           static_cast<unsigned long long>(flashWrites()), static_cast<unsigned long>(transitions),
+           static_cast<unsigned long long>(progressBudget + transitions));
+  TEST_MESSAGE(summary);
+  TEST_ASSERT_LESS_OR_EQUAL(progressBudget + transitions, flashWrites());
+  // Progress saves do happen: a reset loses at most one interval
+  TEST_ASSERT_GREATER_THAN(transitions, flashWrites());
+}
+
+// A transition is written at once; pause, resume, new durations and a
+// restart pressed within the following second fold into one more write once
+// the minimum gap has passed, and that write is the final state
+void test_burst_of_transitions_is_one_write() {
+  pomodoro_start_work();
+  step(10 * MS);
+  TEST_ASSERT_EQUAL(1, flashWrites());
+  const uint64_t firstWriteUs = native_hal_now_us();
+  uint32_t coalescedBefore = persist_get_stats().coalesced;
+
+  step(150 * MS);
+  pomodoro_pause();
+  step(150 * MS);
+  pomodoro_resume();
+  step(150 * MS);
+  pomodoro_set_work_duration(50 * 60);
+  pomodoro_set_short_break_duration(10 * 60);
+  step(150 * MS);
+  pomodoro_reset();
+  step(150 * MS);
+  pomodoro_start_work();
+  step(150 * MS);
+  pomodoro_pause();
+
+  while (native_hal_now_us() + 10 * MS < firstWriteUs + PERSIST_MIN_WRITE_GAP_MS * MS) {
+    TEST_ASSERT_EQUAL(1, flashWrites());
+    step(10 * MS);
+  }
+  step(20 * MS);
+  TEST_ASSERT_EQUAL(2, flashWrites());
+  TEST_ASSERT_GREATER_THAN(coalescedBefore, persist_get_stats().coalesced);
+
+  PomodoroSnapshot live;
+  PomodoroSnapshot stored;
+  pomodoro_get_snapshot(&live);
+  TEST_ASSERT_TRUE(persist_load_pomodoro(&stored));
+  TEST_ASSERT_TRUE(sameSnapshot(live, stored));
+  TEST_ASSERT_EQUAL(POMODORO_PAUSED, stored.state);
+  TEST_ASSERT_EQUAL(50 * 60, stored.workDuration);
+
+  // Paused, nothing left to save
+  for (int i = 0; i < 100; i++) {
+    step(PERSIST_PROGRESS_INTERVAL_MS * MS / 10);
+  }
+  TEST_ASSERT_EQUAL(2, flashWrites());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_idle_day_writes_nothing);
+  RUN_TEST(test_busy_day_stays_within_write_budget);
+  RUN_TEST(test_burst_of_transitions_is_one_write);
+  return UNITY_END();
+}
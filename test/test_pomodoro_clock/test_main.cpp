@@ -0,0 +1,164 @@
+// Pomodoro timing on the virtual clock: eight hours of back-to-back
+// sessions with random loop stalls (including the ~4 s blocking
+// animations) and pauses must not drift from the clock by 1 ms.
+//
+// Run with: pio test -e native -f test_pomodoro_clock
+
+#include <Arduino.h>
+#include <unity.h>
+#include "native_hal.h"
+#include "pomodoro.h"
+
+namespace {
+const int64_t MS = 1000;
+const int64_t SECOND = 1000 * MS;
+const int64_t HOUR = 3600 * SECOND;
+
+uint32_t seed = 1;
+
+uint32_t nextRandom() {
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+// A loop() iteration as the device sees it: mostly short, sometimes a slow
+// redraw or network call, now and then a blocking eye animation
+int64_t randomStall() {
+  uint32_t roll = nextRandom() % 1000;
+  if (roll < 900) return nextRandom() % (20 * MS);
+  if (roll < 980) return 100 * MS + nextRandom() % (1400 * MS);
+  return 4000 * MS + nextRandom() % (300 * MS);
+}
+
+struct Session {
+  int64_t durationUs;
+  int64_t startUs;     // virtual clock at start
+  int64_t pausedUs;    // virtual time spent paused so far
+};
+
+// Remaining time the firmware works with, against the remaining time of an
+// ideal timer on the same clock
+int64_t remainingError(const Session& session) {
+  int64_t nowUs = static_cast<int64_t>(native_hal_now_us());
+  int64_t expectedUs = session.durationUs - (nowUs - session.startUs - session.pausedUs);
+  int64_t error = (pomodoro_get_deadline_us() - nowUs) - expectedUs;
+  return error < 0 ? -error : error;
+}
+}  // namespace
+
+void setUp() {
+  native_hal_set_quiet(true);
+  seed = 12345;
+  pomodoro_init();
+  pomodoro_set_work_duration(WORK_DURATION);
+  pomodoro_set_short_break_duration(SHORT_BREAK_DURATION);
+  pomodoro_set_long_break_duration(LONG_BREAK_DURATION);
+}
+
+void tearDown() {}
+
+void test_eight_hours_with_stalls_do_not_drift() {
+  const int64_t endUs = static_cast<int64_t>(native_hal_now_us()) + 8 * HOUR;
+  int64_t worstSampleErrorUs = 0;
+  int64_t totalDriftUs = 0;
+  int sessions = 0;
+  bool work = true;
+
+  while (static_cast<int64_t>(native_hal_now_us()) < endUs) {
+    if (work) {
+      pomodoro_start_work();
+    } else {
+      pomodoro_start_break();
+    }
+    Session session;
+    session.durationUs = static_cast<int64_t>(pomodoro_get_ms_until_deadline()) * MS;
+    session.startUs = static_cast<int64_t>(native_hal_now_us());
+    session.pausedUs = 0;
+    TEST_ASSERT_TRUE(session.durationUs == WORK_DURATION * SECOND ||
+                     session.durationUs == SHORT_BREAK_DURATION * SECOND ||
+                     session.durationUs == LONG_BREAK_DURATION * SECOND);
+
+    for (;;) {
+      // Where the session ends, in running time, as the firmware has it now
+      int64_t deadlineUs = pomodoro_get_deadline_us();
+      int64_t plannedEndUs = deadlineUs - session.startUs - session.pausedUs;
+
+      int64_t stall = randomStall();
+      native_hal_advance_us(stall);
+
+      // Occasionally pause for up to a minute
+      if (nextRandom() % 500 == 0) {
+        pomodoro_pause();
+        int64_t pausedFor = SECOND + nextRandom() % (60 * SECOND);
+        native_hal_advance_us(pausedFor);
+        pomodoro_update();
+        pomodoro_resume();
+        session.pausedUs += pausedFor;
+      }
+
+      pomodoro_update();
+      if (pomodoro_is_finished()) {
+        int64_t runUs = static_cast<int64_t>(native_hal_now_us()) - session.startUs - session.pausedUs;
+        // Never early, and noticed on the first update past the deadline
+        TEST_ASSERT_GREATER_OR_EQUAL(session.durationUs, runUs);
+        TEST_ASSERT_LESS_OR_EQUAL(stall, runUs - session.durationUs);
+        int64_t drift = plannedEndUs - session.durationUs;
+        totalDriftUs += drift < 0 ? -drift : drift;
+        break;
+      }
+
+      int64_t error = remainingError(session);
+      if (error > worstSampleErrorUs) worstSampleErrorUs = error;
+      TEST_ASSERT_LESS_THAN_MESSAGE(MS, error, "remaining time drifted from the clock");
+      // What the display shows is the same, rounded up to the millisecond
+      TEST_ASSERT_INT64_WITHIN(MS - 1, pomodoro_get_deadline_us() - static_cast<int64_t>(native_hal_now_us()),
+                               static_cast<int64_t>(pomodoro_get_ms_until_deadline()) * MS);
+    }
+
+    sessions++;
+    work = !work;
+  }
+
+  char summary[160];
+  snprintf(summary, sizeof(summary), "%d sessions, drift %lld us total, worst sample error %lld us",
+           sessions, static_cast<long long>(totalDriftUs), static_cast<long long>(worstSampleErrorUs));
+  TEST_MESSAGE(summary);
+  TEST_ASSERT_LESS_THAN(MS, totalDriftUs);
+  TEST_ASSERT_GREATER_OR_EQUAL(14, sessions);
+}
+
+// The old counter subtracted one second per update and dropped whatever a
+// blocking call added on top; a single long stall must cost nothing now
+void test_blocking_stall_loses_no_time() {
+  pomodoro_start_work();
+  uint64_t startUs = native_hal_now_us();
+  native_hal_advance_us(4 * SECOND + 700 * MS);
+  pomodoro_update();
+  native_hal_advance_us(300 * MS);
+  pomodoro_update();
+  uint64_t elapsedUs = native_hal_now_us() - startUs;
+  TEST_ASSERT_EQUAL(WORK_DURATION * SECOND - static_cast<int64_t>(elapsedUs),
+                    static_cast<int64_t>(pomodoro_get_ms_until_deadline()) * MS);
+  TEST_ASSERT_EQUAL(WORK_DURATION - 5, pomodoro_get_time_remaining());
+}
+
+void test_pause_freezes_remaining_time() {
+  pomodoro_start_work();
+  native_hal_advance_us(90 * SECOND + 250 * MS);
+  pomodoro_update();
+  unsigned long before = pomodoro_get_ms_until_deadline();
+  pomodoro_pause();
+  native_hal_advance_us(HOUR);
+  pomodoro_update();
+  pomodoro_resume();
+  TEST_ASSERT_EQUAL(before, pomodoro_get_ms_until_deadline());
+  TEST_ASSERT_EQUAL(POMODORO_WORK, pomodoro_get_state());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_eight_hours_with_stalls_do_not_drift);
+  RUN_TEST(test_blocking_stall_loses_no_time);
+  RUN_TEST(test_pause_freezes_remaining_time);
+  return UNITY_END();
+}
@@ -0,0 +1,93 @@
+// The WiFi state machine never gives up for good: a failed series of
+// attempts switches the radio off for WIFI_RETRY_INTERVAL_MS and then
+// starts a new one, and a connection that drops is picked up again.
+//
+// Run with: pio test -e native -f test_wifi_retry
+
+#include <Arduino.h>
+#include <unity.h>
+#include "native_hal.h"
+#include "request.h"
+
+namespace {
+const uint64_t MS = 1000;
+const unsigned long STEP_MS = 100;
+
+// Poll request_update() like loop() until `state` or `limitMs` passes;
+// returns the milliseconds it took
+unsigned long runUntil(WifiConnectionState state, unsigned long limitMs) {
+  unsigned long startMs = millis();
+  while (request_update() != state) {
+    TEST_ASSERT_TRUE_MESSAGE(millis() - startMs <= limitMs, "state not reached in time");
+    native_hal_advance_us(STEP_MS * MS);
+  }
+  return millis() - startMs;
+}
+
+// A series: WIFI_MAX_ATTEMPTS timeouts and the backoffs between them
+unsigned long seriesMs() {
+  unsigned long total = WIFI_MAX_ATTEMPTS * WIFI_ATTEMPT_TIMEOUT_MS;
+  unsigned long backoff = WIFI_BACKOFF_MIN_MS;
+  for (int i = 1; i < WIFI_MAX_ATTEMPTS; i++) {
+    total += backoff < WIFI_BACKOFF_MAX_MS ? backoff : WIFI_BACKOFF_MAX_MS;
+    backoff *= 2;
+  }
+  return total;
+}
+}  // namespace
+
+void setUp() {
+  native_hal_set_quiet(true);
+}
+
+void tearDown() {}
+
+void test_failed_series_retries_after_the_interval() {
+  static const char body[] = "[]";
+  native_net_set_body(body, sizeof(body) - 1);
+  native_net_set_link(false);
+  request_begin("test", "test");
+
+  // Out of attempts: the radio goes off and stays off until the interval
+  unsigned long failedAfterMs = runUntil(WIFI_CONN_FAILED, seriesMs() + 2 * STEP_MS);
+  TEST_ASSERT_GREATER_OR_EQUAL(seriesMs(), failedAfterMs);
+  TEST_ASSERT_EQUAL(WIFI_RETRY_INTERVAL_MS, request_ms_until_wifi_retry(millis()));
+
+  for (int round = 0; round < 3; round++) {
+    native_hal_advance_us((WIFI_RETRY_INTERVAL_MS - STEP_MS) * MS);
+    TEST_ASSERT_EQUAL(WIFI_CONN_FAILED, request_update());
+    TEST_ASSERT_EQUAL(STEP_MS, request_ms_until_wifi_retry(millis()));
+    native_hal_advance_us(STEP_MS * MS);
+    TEST_ASSERT_EQUAL(0, request_ms_until_wifi_retry(millis()));
+    TEST_ASSERT_EQUAL(WIFI_CONN_CONNECTING, request_update());
+    // Still nobody there: another full series, then off again
+    runUntil(WIFI_CONN_FAILED, seriesMs() + 2 * STEP_MS);
+  }
+
+  // The access point comes back during the off time: the next series connects
+  native_net_set_link(true);
+  runUntil(WIFI_CONN_CONNECTED, WIFI_RETRY_INTERVAL_MS + 2 * STEP_MS);
+  TEST_ASSERT_TRUE(request_is_wifi_connected());
+}
+
+void test_dropped_link_reconnects() {
+  native_net_set_link(true);
+  runUntil(WIFI_CONN_CONNECTED, WIFI_RETRY_INTERVAL_MS + seriesMs());
+
+  native_net_set_link(false);
+  native_hal_advance_us(STEP_MS * MS);
+  TEST_ASSERT_EQUAL(WIFI_CONN_CONNECTING, request_update());
+  TEST_ASSERT_FALSE(request_is_wifi_connected());
+
+  // Back within a few backoffs: connected again without a failed series
+  native_hal_advance_us(3 * WIFI_ATTEMPT_TIMEOUT_MS * MS);
+  native_net_set_link(true);
+  runUntil(WIFI_CONN_CONNECTED, WIFI_BACKOFF_MAX_MS + WIFI_ATTEMPT_TIMEOUT_MS);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_failed_series_retries_after_the_interval);
+  RUN_TEST(test_dropped_link_reconnects);
+  return UNITY_END();
+}